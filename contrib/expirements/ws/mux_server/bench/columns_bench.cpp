@@ -0,0 +1,186 @@
+/*
+ * What the page spends per epoch parsing and reducing traffic rows sent as
+ * l2_dev_comm messages against the same rows sent as ?layout=columnar.
+ *
+ * The columnar frames come from write_columns, the rows are reduced into
+ * draw commands the way WsBroker::reduceEpochStep and reduceColumns do in
+ * src/ws_context.cpp, with coalescing off.
+ */
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "epoch.pb.hpp"
+#include "epoch_stream.hpp"
+#include "l2_columns.hpp"
+
+static const int ROUNDS = 50;
+
+// DrawCmd from src/evenbettercap.h
+struct draw_cmd {
+    enum kind_t: uint8_t { ENTER_DEVICE, TRAFFIC, POOL_HIT, L3_ADDR, ARP_ROW, EPOCH_END };
+
+    kind_t kind;
+    uint8_t pool;
+    uint32_t src_id;
+    uint32_t dst_id;
+    uint32_t ipv4;
+    uint64_t src_mac;
+    uint64_t dst_mac;
+    uint32_t cnt[4];
+    double ingest_ms;
+};
+
+static void set_counts(draw_cmd *cmd, const epoch::L2Summary &l2sum) {
+    cmd->cnt[0] = l2sum.ipv4();
+    cmd->cnt[1] = l2sum.ipv6();
+    cmd->cnt[2] = l2sum.arp();
+    cmd->cnt[3] = l2sum.unknown();
+}
+
+static void reduce_rows(const epoch::EpochStep &es, std::vector<draw_cmd> *out) {
+    draw_cmd cmd;
+    for (int i = 0; i < es.l2_dev_comm_size(); i++) {
+        const epoch::DeviceComm &devComm = es.l2_dev_comm(i);
+
+        const epoch::L2Summary *pools[4] = {
+            &devComm.bcast_33(), &devComm.bcast_ff(), &devComm.bcast_01(), &devComm.bcast_xx()
+        };
+        for (int p = 0; p < 4; p++) {
+            const epoch::L2Summary &l2sum = *pools[p];
+            if (l2sum.ipv4() + l2sum.ipv6() + l2sum.arp() + l2sum.unknown() == 0) {
+                continue;
+            }
+            cmd = draw_cmd();
+            cmd.kind = draw_cmd::POOL_HIT;
+            cmd.pool = p;
+            cmd.src_mac = devComm.mac_src();
+            cmd.src_id = devComm.src_id();
+            set_counts(&cmd, l2sum);
+            out->push_back(cmd);
+        }
+
+        for (int k = 0; k < devComm.tx_summary_size(); k++) {
+            const epoch::L2Summary &l2sum = devComm.tx_summary(k);
+
+            cmd = draw_cmd();
+            cmd.kind = draw_cmd::TRAFFIC;
+            cmd.src_mac = devComm.mac_src();
+            cmd.src_id = devComm.src_id();
+            cmd.dst_mac = l2sum.mac_dst();
+            cmd.dst_id = l2sum.dst_id();
+            set_counts(&cmd, l2sum);
+            out->push_back(cmd);
+        }
+    }
+}
+
+static void reduce_columns(const epoch::L2Columns &cols, std::vector<draw_cmd> *out) {
+    const int n = cols.src_id_size();
+    const uint32_t *src = cols.src_id().data();
+    const uint32_t *dst = cols.dst_id().data();
+    const uint32_t *ipv4 = cols.ipv4().data();
+    const uint32_t *ipv6 = cols.ipv6().data();
+    const uint32_t *arp = cols.arp().data();
+    const uint32_t *unknown = cols.unknown().data();
+
+    if (cols.dst_id_size() != n || cols.ipv4_size() != n || cols.ipv6_size() != n ||
+        cols.arp_size() != n || cols.unknown_size() != n) {
+        return;
+    }
+
+    draw_cmd cmd = draw_cmd();
+    cmd.kind = draw_cmd::TRAFFIC;
+    for (int i = 0; i < n; i++) {
+        cmd.src_id = src[i];
+        cmd.dst_id = dst[i];
+        cmd.cnt[0] = ipv4[i];
+        cmd.cnt[1] = ipv6[i];
+        cmd.cnt[2] = arp[i];
+        cmd.cnt[3] = unknown[i];
+        out->push_back(cmd);
+    }
+
+    const int m = cols.bcast_src_id_size();
+    if (cols.bcast_pool_size() != m || cols.bcast_ipv4_size() != m || cols.bcast_ipv6_size() != m ||
+        cols.bcast_arp_size() != m || cols.bcast_unknown_size() != m) {
+        return;
+    }
+
+    cmd = draw_cmd();
+    cmd.kind = draw_cmd::POOL_HIT;
+    for (int i = 0; i < m; i++) {
+        if (cols.bcast_pool(i) > 3) {
+            continue;
+        }
+        cmd.pool = cols.bcast_pool(i);
+        cmd.src_id = cols.bcast_src_id(i);
+        cmd.cnt[0] = cols.bcast_ipv4(i);
+        cmd.cnt[1] = cols.bcast_ipv6(i);
+        cmd.cnt[2] = cols.bcast_arp(i);
+        cmd.cnt[3] = cols.bcast_unknown(i);
+        out->push_back(cmd);
+    }
+}
+
+static void reduce(const epoch::EpochStep &es, std::vector<draw_cmd> *out) {
+    reduce_rows(es, out);
+    if (es.has_l2_columns()) {
+        reduce_columns(es.l2_columns(), out);
+    }
+}
+
+static void run(const char *name, const std::vector<std::string> &frames) {
+    typedef std::chrono::steady_clock bench_clock;
+
+    epoch::EpochStep es;
+    std::vector<draw_cmd> cmds;
+    uint64_t bytes = 0, count = 0;
+    double parse_s = 0, reduce_s = 0;
+
+    for (int r = 0; r < ROUNDS; r++) {
+        for (const std::string &frame : frames) {
+            auto start = bench_clock::now();
+            es.ParseFromString(frame);
+            auto parsed = bench_clock::now();
+            cmds.clear();
+            reduce(es, &cmds);
+            auto reduced = bench_clock::now();
+
+            parse_s += std::chrono::duration<double>(parsed - start).count();
+            reduce_s += std::chrono::duration<double>(reduced - parsed).count();
+            bytes += frame.size();
+            count += cmds.size();
+        }
+    }
+
+    double n = double(ROUNDS) * frames.size();
+    printf("%-8s %6.0f bytes  %7.0f ns parse  %7.0f ns reduce  %7.0f ns total  %5.0f commands per epoch\n",
+           name, bytes / n, parse_s * 1e9 / n, reduce_s * 1e9 / n, (parse_s + reduce_s) * 1e9 / n, count / n);
+}
+
+int main(int argc, char *argv[]) {
+    std::vector<std::string> rows;
+    if (argc > 1) {
+        if (!read_recording(argv[1], &rows)) {
+            fprintf(stderr, "could not read %s\n", argv[1]);
+            return 1;
+        }
+    } else {
+        synthesize(&rows);
+    }
+
+    std::vector<std::string> columns;
+    epoch::EpochStep in, out;
+    for (const std::string &frame : rows) {
+        in.ParseFromString(frame);
+        out.Clear();
+        write_columns(in, &out);
+        columns.push_back(out.SerializeAsString());
+    }
+
+    run("rows", rows);
+    run("columnar", columns);
+    return 0;
+}
@@ -0,0 +1,148 @@
+/*
+ * Wire bytes of an epoch stream with and without ?compress=deflate, and
+ * what each costs the browser to decode.
+ *
+ *   mux_server 9999 9002 --record=epochs.bin
+ *   deflate_bench epochs.bin
+ *
+ * Epochs are deflated the way deflate_frame does it and inflated with the
+ * loop the page uses. Without a recording a synthetic stream is generated
+ * instead, so runs without a sensor only show the shape of the numbers.
+ */
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <zlib.h>
+
+#include "epoch.pb.hpp"
+#include "epoch_stream.hpp"
+
+static const int ROUNDS = 20;
+
+typedef std::chrono::steady_clock bench_clock;
+
+static double micros(bench_clock::time_point start, bench_clock::time_point end) {
+    return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+static std::string deflate_epoch(const std::string &payload) {
+    std::string buf;
+    uLongf len = compressBound(payload.size());
+    buf.resize(len);
+    compress2(reinterpret_cast<Bytef*>(&buf[0]), &len,
+              reinterpret_cast<const Bytef*>(payload.data()), payload.size(),
+              Z_DEFAULT_COMPRESSION);
+    buf.resize(len);
+    return buf;
+}
+
+// inflateEpoch from src/ws_context.cpp
+static bool inflate_epoch(const uint8_t *data, size_t size, std::string *out) {
+    z_stream zs = z_stream();
+    if (inflateInit(&zs) != Z_OK) {
+        return false;
+    }
+
+    zs.next_in = const_cast<Bytef*>(data);
+    zs.avail_in = size;
+
+    out->resize(std::max(out->capacity(), size * 4));
+    size_t have = 0;
+    int ret;
+    do {
+        if (have == out->size()) {
+            out->resize(out->size() * 2);
+        }
+        zs.next_out = reinterpret_cast<Bytef*>(&(*out)[have]);
+        zs.avail_out = out->size() - have;
+        ret = inflate(&zs, Z_NO_FLUSH);
+        have = out->size() - zs.avail_out;
+    } while (ret == Z_OK);
+
+    inflateEnd(&zs);
+    out->resize(have);
+    return ret == Z_STREAM_END;
+}
+
+static bool report(const char *name, const std::vector<std::string> &epochs) {
+    std::vector<std::string> deflated;
+    uint64_t raw_bytes = 0, deflated_bytes = 0;
+    for (auto it = epochs.begin(); it != epochs.end(); it++) {
+        deflated.push_back(deflate_epoch(*it));
+        raw_bytes += it->size();
+        deflated_bytes += deflated.back().size();
+    }
+
+    auto start = bench_clock::now();
+    for (int r = 0; r < ROUNDS; r++) {
+        for (auto it = epochs.begin(); it != epochs.end(); it++) {
+            deflate_epoch(*it);
+        }
+    }
+    double deflate_us = micros(start, bench_clock::now()) / ROUNDS;
+
+    std::string buf;
+    for (size_t i = 0; i < epochs.size(); i++) {
+        const std::string &d = deflated[i];
+        if (!inflate_epoch(reinterpret_cast<const uint8_t*>(d.data()), d.size(), &buf) || buf != epochs[i]) {
+            fprintf(stderr, "epoch %zu does not round trip\n", i);
+            return false;
+        }
+    }
+
+    // What the page does with each frame: parse it, inflating it first if
+    // it was deflated
+    epoch::EpochStep step;
+    start = bench_clock::now();
+    for (int r = 0; r < ROUNDS; r++) {
+        for (auto it = epochs.begin(); it != epochs.end(); it++) {
+            step.ParseFromArray(it->data(), it->size());
+        }
+    }
+    double parse_us = micros(start, bench_clock::now()) / ROUNDS;
+
+    start = bench_clock::now();
+    for (int r = 0; r < ROUNDS; r++) {
+        for (auto it = deflated.begin(); it != deflated.end(); it++) {
+            inflate_epoch(reinterpret_cast<const uint8_t*>(it->data()), it->size(), &buf);
+        }
+    }
+    double inflate_us = micros(start, bench_clock::now()) / ROUNDS;
+
+    double n = epochs.size();
+    printf("%s\n", name);
+    printf("epochs          %zu\n", epochs.size());
+    printf("raw bytes       %llu (%.0f per epoch)\n", (unsigned long long)raw_bytes, raw_bytes / n);
+    printf("deflated bytes  %llu (%.0f per epoch)\n", (unsigned long long)deflated_bytes, deflated_bytes / n);
+    printf("ratio           %.3f\n", double(deflated_bytes) / raw_bytes);
+    printf("deflate         %.1f us per epoch, on the server once per epoch\n", deflate_us / n);
+    printf("parse           %.1f us per epoch\n", parse_us / n);
+    printf("inflate         %.1f us per epoch, on top of parse\n", inflate_us / n);
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    std::vector<std::string> epochs;
+    if (argc > 1) {
+        if (!read_recording(argv[1], &epochs) || epochs.empty()) {
+            fprintf(stderr, "could not read %s\n", argv[1]);
+            return 1;
+        }
+        return report(argv[1], epochs) ? 0 : 1;
+    }
+
+    // Without a recording the synthetic stream is measured twice, as the
+    // server writes it and with every row naming its devices by mac
+    synthesize(&epochs);
+    if (!report("synthetic stream, rows keyed by id", epochs)) {
+        return 1;
+    }
+
+    epochs.clear();
+    synthesize(&epochs, false);
+    printf("\n");
+    return report("synthetic stream, rows keyed by mac", epochs) ? 0 : 1;
+}
@@ -0,0 +1,142 @@
+/*
+ * Epochs per second encode_epoch_step gets through with the telemetry
+ * thread encoding inline and with a pool of parse workers, as
+ * --workers=<n> sets up in mux_server.
+ *
+ * Workers take epochs in order and hand them to a reorder map under one
+ * lock the way parse_loop and complete_job do, and share one device
+ * registry. The epochs are synthetic: 300 talkers out of 2000 devices,
+ * each reaching one to four peers.
+ */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "broker/broker.hh"
+#include "broker/zeek.hh"
+
+#include "input_parser.hpp"
+
+static const int DEVICES = 2000;
+static const int TALKERS = 300;
+static const int EPOCHS = 400;
+static const int ROUNDS = 5;
+
+static std::string mac_string(uint64_t mac) {
+    char buf[18];
+    const uint8_t *b = reinterpret_cast<const uint8_t *>(&mac);
+    snprintf(buf, sizeof buf, "%02x:%02x:%02x:%02x:%02x:%02x", b[0], b[1], b[2], b[3], b[4], b[5]);
+    return buf;
+}
+
+static std::vector<broker::zeek::Event> synthesize() {
+    std::mt19937_64 rng(7);
+    std::vector<std::string> macs;
+    for (int i = 0; i < DEVICES; i++) {
+        macs.push_back(mac_string(rng() & 0xfeffffffffffull));
+    }
+
+    std::geometric_distribution<broker::count> packets(0.05);
+    std::vector<broker::zeek::Event> epochs;
+    for (int e = 0; e < EPOCHS; e++) {
+        broker::set devices;
+        if (e == 0) {
+            for (const std::string &mac : macs) {
+                devices.insert(mac);
+            }
+        }
+
+        broker::table comm;
+        for (int t = 0; t < TALKERS; t++) {
+            broker::table tx;
+            int peers = 1 + rng() % 4;
+            for (int p = 0; p < peers; p++) {
+                tx[macs[rng() % 4 ? rng() % 8 : rng() % DEVICES]] =
+                    broker::vector{packets(rng), broker::count(rng() % 8 ? 0 : packets(rng)),
+                                   broker::count(0), broker::count(0)};
+            }
+            comm[macs[rng() % DEVICES]] = broker::vector{broker::count(0), tx, broker::data{},
+                                                         broker::data{}, broker::data{}, broker::data{}};
+        }
+
+        broker::vector wrapper{devices, comm, broker::table{}, broker::table{}};
+        epochs.emplace_back("epoch_step", broker::vector{wrapper});
+    }
+    return epochs;
+}
+
+// Epochs per second with no handoff, --workers left unset
+static double inline_rate(std::vector<broker::zeek::Event> &epochs) {
+    device_registry ids;
+    BrokerCtx ctx;
+    ctx.registry = &ids;
+    std::string out;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < ROUNDS; r++) {
+        for (auto &event : epochs) {
+            out.clear();
+            ctx.encode_epoch_step(event, "", &out);
+        }
+    }
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return ROUNDS * epochs.size() / secs;
+}
+
+static double pool_rate(std::vector<broker::zeek::Event> &epochs, unsigned workers) {
+    device_registry ids;
+    std::atomic<size_t> next(0);
+    std::mutex reorder_lock;
+    std::map<size_t, std::string> reorder;
+    size_t next_publish = 0;
+    size_t total = ROUNDS * epochs.size();
+
+    auto work = [&] {
+        BrokerCtx ctx;
+        ctx.registry = &ids;
+        size_t seq;
+        while ((seq = next++) < total) {
+            std::string out;
+            ctx.encode_epoch_step(epochs[seq % epochs.size()], "", &out);
+
+            std::lock_guard<std::mutex> guard(reorder_lock);
+            reorder.insert(std::make_pair(seq, std::move(out)));
+            auto it = reorder.begin();
+            while (it != reorder.end() && it->first == next_publish) {
+                next_publish++;
+                it = reorder.erase(it);
+            }
+        }
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < workers; i++) {
+        threads.emplace_back(work);
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return total / secs;
+}
+
+int main() {
+    std::vector<broker::zeek::Event> epochs = synthesize();
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    printf("cores %u\n", cores);
+
+    printf("inline     %8.0f epochs/s\n", inline_rate(epochs));
+    for (unsigned workers = 1; workers <= std::max(4u, 2 * cores); workers *= 2) {
+        printf("workers=%-2u %8.0f epochs/s\n", workers, pool_rate(epochs, workers));
+    }
+    return 0;
+}
@@ -0,0 +1,98 @@
+#ifndef _INCL_EPOCH_STREAM
+#define _INCL_EPOCH_STREAM
+
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "epoch.pb.hpp"
+
+/*
+ * Payloads of a file written by mux_server --record, each prefixed by its
+ * length as a little endian 32 bit integer.
+ */
+inline bool read_recording(const char *path, std::vector<std::string> *epochs) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return false;
+    }
+
+    unsigned char prefix[4];
+    while (in.read(reinterpret_cast<char*>(prefix), sizeof prefix)) {
+        uint32_t len = prefix[0] | prefix[1] << 8 | prefix[2] << 16 | uint32_t(prefix[3]) << 24;
+        std::string payload(len, '\0');
+        if (!in.read(&payload[0], len)) {
+            return false;
+        }
+        epochs->push_back(payload);
+    }
+    return true;
+}
+
+/*
+ * A network of 2000 devices spread over a few vendors. Every device is
+ * announced in the first epoch, afterwards each epoch carries a few hundred
+ * talkers that mostly reach a handful of busy hosts. Rows name devices by
+ * id as mux_server encodes them, or by mac as before it handed out ids.
+ */
+inline void synthesize(std::vector<std::string> *epochs, bool ids = true) {
+    const int DEVICES = 2000;
+    const int EPOCHS = 600;
+    const int TALKERS = 300;
+
+    std::mt19937 rng(13);
+    std::vector<uint64_t> ouis;
+    for (int i = 0; i < 16; i++) {
+        ouis.push_back(rng() & 0xfeffff);
+    }
+
+    // Device i has id i + 1
+    std::vector<uint64_t> macs;
+    epoch::EpochStep step;
+    for (int i = 0; i < DEVICES; i++) {
+        uint64_t nic = rng() & 0xffffff;
+        macs.push_back(ouis[rng() % ouis.size()] | nic << 24);
+        step.add_enter_l2devices(macs.back());
+        if (ids) {
+            step.add_enter_l2device_ids(i + 1);
+        }
+    }
+    epochs->push_back(step.SerializeAsString());
+
+    std::geometric_distribution<uint32_t> packets(0.05);
+    for (int e = 1; e < EPOCHS; e++) {
+        step.Clear();
+        for (int t = 0; t < TALKERS; t++) {
+            epoch::DeviceComm *comm = step.add_l2_dev_comm();
+            uint32_t src = rng() % DEVICES;
+            if (ids) {
+                comm->set_src_id(src + 1);
+            } else {
+                comm->set_mac_src(macs[src]);
+            }
+
+            int peers = 1 + rng() % 4;
+            for (int p = 0; p < peers; p++) {
+                epoch::L2Summary *sum = comm->add_tx_summary();
+                uint32_t dst = rng() % 4 ? rng() % 8 : rng() % DEVICES;
+                if (ids) {
+                    sum->set_dst_id(dst + 1);
+                } else {
+                    sum->set_mac_dst(macs[dst]);
+                }
+                sum->set_ipv4(packets(rng));
+                if (rng() % 8 == 0) {
+                    sum->set_ipv6(packets(rng));
+                }
+            }
+            if (rng() % 16 == 0) {
+                comm->mutable_bcast_ff()->set_arp(1 + rng() % 3);
+            }
+        }
+        epochs->push_back(step.SerializeAsString());
+    }
+}
+
+#endif
@@ -0,0 +1,116 @@
+/*
+ * Bytes per second a ?delta=1 client receives against one that gets every
+ * epoch in full, with Zeek's 150 ms tick and the defaults of
+ * --keyframe-every and --delta-threshold.
+ *
+ * Deltas only pay off when pairs keep talking at a similar rate, so besides
+ * the shared synthetic stream, whose talkers are drawn anew every epoch,
+ * this runs a stream of long lived flows whose rates wobble by up to 10%
+ * and of which 1% start or stop each epoch.
+ */
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "epoch.pb.hpp"
+#include "epoch_stream.hpp"
+#include "rate_delta.hpp"
+
+static const double TICK_S = 0.150;
+static const int KEYFRAME_EVERY_S = 10;
+static const unsigned THRESHOLD = 25;
+
+static void synthesize_flows(std::vector<std::string> *epochs) {
+    const int DEVICES = 2000;
+    const int FLOWS = 1500;
+    const int EPOCHS = 600;
+
+    struct flow {
+        uint32_t src, dst, base;
+        bool active;
+    };
+
+    std::mt19937 rng(12);
+    std::geometric_distribution<uint32_t> base(0.05);
+    std::vector<flow> flows;
+    for (int i = 0; i < FLOWS; i++) {
+        flows.push_back(flow{1 + uint32_t(rng() % DEVICES), 1 + uint32_t(rng() % DEVICES),
+                             1 + base(rng), true});
+    }
+    std::sort(flows.begin(), flows.end(), [](const flow &a, const flow &b) { return a.src < b.src; });
+
+    epoch::EpochStep step;
+    for (int e = 0; e < EPOCHS; e++) {
+        step.Clear();
+        epoch::DeviceComm *comm = nullptr;
+        for (flow &f : flows) {
+            if (rng() % 100 == 0) {
+                f.active = !f.active;
+            }
+            if (!f.active) {
+                continue;
+            }
+            if (comm == nullptr || comm->src_id() != f.src) {
+                comm = step.add_l2_dev_comm();
+                comm->set_src_id(f.src);
+            }
+            epoch::L2Summary *sum = comm->add_tx_summary();
+            sum->set_dst_id(f.dst);
+            sum->set_ipv4(std::max(1u, uint32_t(f.base * (0.9 + 0.2 * (rng() % 1000) / 1000.0))));
+        }
+        epochs->push_back(step.SerializeAsString());
+    }
+}
+
+static void run(const char *name, const std::vector<std::string> &epochs) {
+    const int keyframe_every = int(KEYFRAME_EVERY_S / TICK_S);
+
+    rate_delta rates;
+    epoch::EpochStep in, out;
+    uint64_t full = 0, delta = 0;
+    for (size_t i = 0; i < epochs.size(); i++) {
+        in.ParseFromString(epochs[i]);
+        out.Clear();
+        rates.write(in, &out, i % keyframe_every == 0, THRESHOLD);
+
+        full += epochs[i].size();
+        delta += out.ByteSizeLong();
+
+        std::set<uint64_t> sources;
+        for (int j = 0; j < out.l2_dev_comm_size(); j++) {
+            if (!sources.insert(device_key::src(out.l2_dev_comm(j))).second) {
+                fprintf(stderr, "%s epoch %zu: source in two rows\n", name, i);
+                exit(1);
+            }
+        }
+    }
+
+    double secs = epochs.size() * TICK_S;
+    printf("%-7s full %8.0f bytes/s  delta %8.0f bytes/s  ratio %.3f\n", name,
+           full / secs, delta / secs, double(delta) / full);
+}
+
+int main(int argc, char *argv[]) {
+    std::vector<std::string> epochs;
+    if (argc > 1) {
+        if (!read_recording(argv[1], &epochs)) {
+            fprintf(stderr, "could not read %s\n", argv[1]);
+            return 1;
+        }
+        run("record", epochs);
+        return 0;
+    }
+
+    synthesize(&epochs);
+    run("random", epochs);
+
+    epochs.clear();
+    synthesize_flows(&epochs);
+    run("flows", epochs);
+    return 0;
+}
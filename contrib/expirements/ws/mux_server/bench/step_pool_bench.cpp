@@ -0,0 +1,87 @@
+/*
+ * Heap allocations and time per epoch of the lazy decode on the asio
+ * thread, mux_server's decoded(), with steps from step_pool against a new
+ * EpochStep per epoch.
+ *
+ * Epochs are decoded into a ring of 256 entries like m_ring, so a step is
+ * released when its slot is reused. Every operator new is counted.
+ */
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "epoch.pb.hpp"
+#include "epoch_stream.hpp"
+#include "step_pool.hpp"
+
+static std::atomic<uint64_t> allocations(0);
+
+void *operator new(std::size_t size) {
+    allocations++;
+    void *p = std::malloc(size ? size : 1);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept {
+    std::free(p);
+}
+
+static const int RING = 256;
+static const int ROUNDS = 10;
+
+template<typename F>
+static void run(const char *name, const std::vector<std::string> &epochs, F acquire) {
+    typedef std::shared_ptr<epoch::EpochStep> step_ptr;
+    std::vector<step_ptr> ring(RING);
+
+    // One pass to fill the ring and warm whatever the variant caches
+    for (size_t seq = 0; seq < epochs.size(); seq++) {
+        step_ptr step = acquire();
+        step->ParseFromString(epochs[seq]);
+        ring[seq % RING] = step;
+    }
+
+    uint64_t before = allocations;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < ROUNDS; r++) {
+        for (size_t seq = 0; seq < epochs.size(); seq++) {
+            step_ptr step = acquire();
+            step->ParseFromString(epochs[seq]);
+            ring[seq % RING] = step;
+        }
+    }
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    double n = double(ROUNDS) * epochs.size();
+
+    printf("%-6s %8.1f allocations per epoch %8.1f us per epoch\n", name,
+           (allocations - before) / n, secs * 1e6 / n);
+}
+
+int main(int argc, char *argv[]) {
+    std::vector<std::string> epochs;
+    if (argc > 1) {
+        if (!read_recording(argv[1], &epochs)) {
+            fprintf(stderr, "could not read %s\n", argv[1]);
+            return 1;
+        }
+    } else {
+        synthesize(&epochs);
+    }
+
+    step_pool pool(RING + 64);
+    run("pool", epochs, [&pool] { return pool.acquire(); });
+    run("new", epochs, [] { return std::make_shared<epoch::EpochStep>(); });
+    return 0;
+}
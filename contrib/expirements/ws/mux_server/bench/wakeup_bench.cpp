@@ -0,0 +1,155 @@
+/*
+ * Wakeup latency and cpu use of the telemetry loop blocking in poll() on a
+ * readiness fd against spinning on a non blocking read, which is what the
+ * loop did with broker's subscriber.poll() before.
+ *
+ * Broker signals a subscriber through a pipe, so a producer thread stands
+ * in for it by writing the time it sent each message into one. Messages
+ * arrive every RATE_US with some jitter for a while, then the producer goes
+ * quiet to measure an idle loop.
+ */
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+static const int MESSAGES = 5000;
+static const int RATE_US = 1000;
+static const int IDLE_MS = 2000;
+
+static int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static double thread_cpu_s() {
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+struct result {
+    std::vector<int64_t> latency_ns;
+    double busy_cpu;
+    double idle_cpu;
+};
+
+/*
+ * Reads every message waiting in the pipe and records how long each one
+ * took to arrive.
+ */
+static int drain(int fd, std::vector<int64_t> *latency) {
+    int64_t sent[64];
+    int got = 0;
+    ssize_t n;
+    while ((n = read(fd, sent, sizeof sent)) > 0) {
+        int64_t now = now_ns();
+        for (size_t i = 0; i < n / sizeof(int64_t); i++) {
+            latency->push_back(now - sent[i]);
+            got++;
+        }
+    }
+    return got;
+}
+
+static result run(bool spin) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        perror("pipe");
+        exit(1);
+    }
+    fcntl(fds[0], F_SETFL, O_NONBLOCK);
+
+    std::atomic<bool> done(false);
+    std::thread producer([&] {
+        std::mt19937 rng(5);
+        for (int i = 0; i < MESSAGES; i++) {
+            std::this_thread::sleep_for(std::chrono::microseconds(RATE_US / 2 + rng() % RATE_US));
+            int64_t sent = now_ns();
+            if (write(fds[1], &sent, sizeof sent) != sizeof sent) {
+                perror("write");
+                exit(1);
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(IDLE_MS));
+        done = true;
+        int64_t last = now_ns();
+        (void)!write(fds[1], &last, sizeof last);
+    });
+
+    result r;
+    r.latency_ns.reserve(MESSAGES + 1);
+
+    int received = 0;
+    double start_cpu = thread_cpu_s();
+    int64_t start = now_ns();
+    double idle_start_cpu = 0;
+    int64_t idle_start = 0;
+
+    pollfd pfd;
+    pfd.fd = fds[0];
+    pfd.events = POLLIN;
+
+    while (!done || received < MESSAGES + 1) {
+        if (!spin) {
+            pfd.revents = 0;
+            int ready = ::poll(&pfd, 1, 1000);
+            if (ready < 0 && errno != EINTR) {
+                perror("poll");
+                exit(1);
+            }
+            if (ready <= 0) {
+                continue;
+            }
+        }
+
+        int got = drain(fds[0], &r.latency_ns);
+        received += got;
+        if (got > 0 && received == MESSAGES) {
+            idle_start_cpu = thread_cpu_s();
+            idle_start = now_ns();
+        }
+        if (received > MESSAGES) {
+            break;
+        }
+    }
+
+    double end_cpu = thread_cpu_s();
+    int64_t end = now_ns();
+    producer.join();
+    close(fds[0]);
+    close(fds[1]);
+
+    // The last message only ends the idle phase
+    r.latency_ns.pop_back();
+    r.busy_cpu = (idle_start_cpu - start_cpu) / ((idle_start - start) / 1e9);
+    r.idle_cpu = (end_cpu - idle_start_cpu) / ((end - idle_start) / 1e9);
+    return r;
+}
+
+static double percentile(std::vector<int64_t> v, double p) {
+    std::sort(v.begin(), v.end());
+    return v[size_t(p * (v.size() - 1))] / 1000.0;
+}
+
+int main() {
+    for (bool spin : {false, true}) {
+        result r = run(spin);
+        printf("%-5s p50 %7.1f us  p99 %7.1f us  max %8.1f us  cpu busy %5.1f%%  idle %5.1f%%\n",
+               spin ? "spin" : "poll",
+               percentile(r.latency_ns, 0.5), percentile(r.latency_ns, 0.99),
+               percentile(r.latency_ns, 1.0), 100 * r.busy_cpu, 100 * r.idle_cpu);
+    }
+    return 0;
+}
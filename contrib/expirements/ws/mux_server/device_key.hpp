@@ -0,0 +1,59 @@
+#ifndef _INCL_DEVICE_KEY
+#define _INCL_DEVICE_KEY
+
+#include <cstdint>
+
+#include "epoch.pb.hpp"
+
+/*
+ * Rows name a device either by the id mux_server gave it or by its mac. A
+ * key holds whichever one a row used so tables can mix both. Macs only use
+ * 48 bits so ids are kept apart by the top bit.
+ */
+namespace device_key {
+
+const uint64_t ID_BIT = uint64_t(1) << 63;
+
+inline uint64_t make(uint64_t mac, uint32_t id) {
+    return id ? (ID_BIT | id) : mac;
+}
+
+inline uint64_t src(const epoch::DeviceComm &dComm) {
+    return make(dComm.mac_src(), dComm.src_id());
+}
+
+inline uint64_t dst(const epoch::L2Summary &l2sum) {
+    return make(l2sum.mac_dst(), l2sum.dst_id());
+}
+
+inline uint64_t of(const epoch::AddrAssoc &addr) {
+    return make(addr.mac_src(), addr.id());
+}
+
+inline void set_src(epoch::DeviceComm *dComm, uint64_t key) {
+    if (key & ID_BIT) {
+        dComm->set_src_id(uint32_t(key));
+    } else {
+        dComm->set_mac_src(key);
+    }
+}
+
+inline void set_dst(epoch::L2Summary *l2sum, uint64_t key) {
+    if (key & ID_BIT) {
+        l2sum->set_dst_id(uint32_t(key));
+    } else {
+        l2sum->set_mac_dst(key);
+    }
+}
+
+inline void set(epoch::AddrAssoc *addr, uint64_t key) {
+    if (key & ID_BIT) {
+        addr->set_id(uint32_t(key));
+    } else {
+        addr->set_mac_src(key);
+    }
+}
+
+}
+
+#endif
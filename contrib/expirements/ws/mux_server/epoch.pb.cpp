@@ -11,274 +11,386 @@
 #include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
-extern PROTOBUF_INTERNAL_EXPORT_epoch_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_AddrAssoc_epoch_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_epoch_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_ArpAssoc_epoch_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_epoch_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_DeviceComm_epoch_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_epoch_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_L2Summary_epoch_2eproto;
-namespace epoch {
-class L2SummaryDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<L2Summary> _instance;
-} _L2Summary_default_instance_;
-class DeviceCommDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<DeviceComm> _instance;
-} _DeviceComm_default_instance_;
-class AddrAssocDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<AddrAssoc> _instance;
-} _AddrAssoc_default_instance_;
-class ArpAssocDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ArpAssoc> _instance;
-} _ArpAssoc_default_instance_;
-class EpochStepDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<EpochStep> _instance;
-} _EpochStep_default_instance_;
-}  // namespace epoch
-static void InitDefaultsscc_info_AddrAssoc_epoch_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
 
-  {
-    void* ptr = &::epoch::_AddrAssoc_default_instance_;
-    new (ptr) ::epoch::AddrAssoc();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::epoch::AddrAssoc::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_AddrAssoc_epoch_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_AddrAssoc_epoch_2eproto}, {}};
+PROTOBUF_PRAGMA_INIT_SEG
 
-static void InitDefaultsscc_info_ArpAssoc_epoch_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-  {
-    void* ptr = &::epoch::_ArpAssoc_default_instance_;
-    new (ptr) ::epoch::ArpAssoc();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::epoch::ArpAssoc::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_ArpAssoc_epoch_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_ArpAssoc_epoch_2eproto}, {
-      &scc_info_AddrAssoc_epoch_2eproto.base,}};
-
-static void InitDefaultsscc_info_DeviceComm_epoch_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::epoch::_DeviceComm_default_instance_;
-    new (ptr) ::epoch::DeviceComm();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+namespace epoch {
+PROTOBUF_CONSTEXPR L2Summary::L2Summary(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.mac_dst_)*/uint64_t{0u}
+  , /*decltype(_impl_.ipv4_)*/0u
+  , /*decltype(_impl_.ipv6_)*/0u
+  , /*decltype(_impl_.arp_)*/0u
+  , /*decltype(_impl_.unknown_)*/0u
+  , /*decltype(_impl_.dst_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct L2SummaryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR L2SummaryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~L2SummaryDefaultTypeInternal() {}
+  union {
+    L2Summary _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 L2SummaryDefaultTypeInternal _L2Summary_default_instance_;
+PROTOBUF_CONSTEXPR DeviceComm::DeviceComm(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.tx_summary_)*/{}
+  , /*decltype(_impl_.bcast_33_)*/nullptr
+  , /*decltype(_impl_.bcast_ff_)*/nullptr
+  , /*decltype(_impl_.bcast_01_)*/nullptr
+  , /*decltype(_impl_.bcast_xx_)*/nullptr
+  , /*decltype(_impl_.mac_src_)*/uint64_t{0u}
+  , /*decltype(_impl_.src_id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DeviceCommDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DeviceCommDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DeviceCommDefaultTypeInternal() {}
+  union {
+    DeviceComm _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DeviceCommDefaultTypeInternal _DeviceComm_default_instance_;
+PROTOBUF_CONSTEXPR AddrAssoc::AddrAssoc(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.mac_src_)*/uint64_t{0u}
+  , /*decltype(_impl_.ipv4_)*/0u
+  , /*decltype(_impl_.id_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct AddrAssocDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR AddrAssocDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~AddrAssocDefaultTypeInternal() {}
+  union {
+    AddrAssoc _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 AddrAssocDefaultTypeInternal _AddrAssoc_default_instance_;
+PROTOBUF_CONSTEXPR ArpAssoc::ArpAssoc(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.table_row_)*/{}
+  , /*decltype(_impl_.mac_src_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ArpAssocDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ArpAssocDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ArpAssocDefaultTypeInternal() {}
+  union {
+    ArpAssoc _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ArpAssocDefaultTypeInternal _ArpAssoc_default_instance_;
+PROTOBUF_CONSTEXPR L2Columns::L2Columns(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.src_id_)*/{}
+  , /*decltype(_impl_._src_id_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.dst_id_)*/{}
+  , /*decltype(_impl_._dst_id_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.ipv4_)*/{}
+  , /*decltype(_impl_._ipv4_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.ipv6_)*/{}
+  , /*decltype(_impl_._ipv6_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.arp_)*/{}
+  , /*decltype(_impl_._arp_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.unknown_)*/{}
+  , /*decltype(_impl_._unknown_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.bcast_src_id_)*/{}
+  , /*decltype(_impl_._bcast_src_id_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.bcast_pool_)*/{}
+  , /*decltype(_impl_._bcast_pool_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.bcast_ipv4_)*/{}
+  , /*decltype(_impl_._bcast_ipv4_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.bcast_ipv6_)*/{}
+  , /*decltype(_impl_._bcast_ipv6_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.bcast_arp_)*/{}
+  , /*decltype(_impl_._bcast_arp_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.bcast_unknown_)*/{}
+  , /*decltype(_impl_._bcast_unknown_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct L2ColumnsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR L2ColumnsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~L2ColumnsDefaultTypeInternal() {}
+  union {
+    L2Columns _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 L2ColumnsDefaultTypeInternal _L2Columns_default_instance_;
+PROTOBUF_CONSTEXPR EpochStep::EpochStep(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.enter_l2devices_)*/{}
+  , /*decltype(_impl_.l2_dev_comm_)*/{}
+  , /*decltype(_impl_.enter_l2_ipv4_addr_src_)*/{}
+  , /*decltype(_impl_.enter_arp_table_)*/{}
+  , /*decltype(_impl_.enter_l2device_ids_)*/{}
+  , /*decltype(_impl_._enter_l2device_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.sensor_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.l2_columns_)*/nullptr
+  , /*decltype(_impl_.encoding_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct EpochStepDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EpochStepDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EpochStepDefaultTypeInternal() {}
+  union {
+    EpochStep _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EpochStepDefaultTypeInternal _EpochStep_default_instance_;
+}  // namespace epoch
+namespace epoch {
+bool RateEncoding_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
   }
-  ::epoch::DeviceComm::InitAsDefaultInstance();
 }
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_DeviceComm_epoch_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_DeviceComm_epoch_2eproto}, {
-      &scc_info_L2Summary_epoch_2eproto.base,}};
+static ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<std::string> RateEncoding_strings[3] = {};
 
-static void InitDefaultsscc_info_EpochStep_epoch_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
+static const char RateEncoding_names[] =
+  "DELTA"
+  "FULL"
+  "KEYFRAME";
 
-  {
-    void* ptr = &::epoch::_EpochStep_default_instance_;
-    new (ptr) ::epoch::EpochStep();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::epoch::EpochStep::InitAsDefaultInstance();
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<3> scc_info_EpochStep_epoch_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 3, 0, InitDefaultsscc_info_EpochStep_epoch_2eproto}, {
-      &scc_info_DeviceComm_epoch_2eproto.base,
-      &scc_info_AddrAssoc_epoch_2eproto.base,
-      &scc_info_ArpAssoc_epoch_2eproto.base,}};
+static const ::PROTOBUF_NAMESPACE_ID::internal::EnumEntry RateEncoding_entries[] = {
+  { {RateEncoding_names + 0, 5}, 2 },
+  { {RateEncoding_names + 5, 4}, 0 },
+  { {RateEncoding_names + 9, 8}, 1 },
+};
 
-static void InitDefaultsscc_info_L2Summary_epoch_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
+static const int RateEncoding_entries_by_number[] = {
+  1, // 0 -> FULL
+  2, // 1 -> KEYFRAME
+  0, // 2 -> DELTA
+};
 
-  {
-    void* ptr = &::epoch::_L2Summary_default_instance_;
-    new (ptr) ::epoch::L2Summary();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-  ::epoch::L2Summary::InitAsDefaultInstance();
+const std::string& RateEncoding_Name(
+    RateEncoding value) {
+  static const bool dummy =
+      ::PROTOBUF_NAMESPACE_ID::internal::InitializeEnumStrings(
+          RateEncoding_entries,
+          RateEncoding_entries_by_number,
+          3, RateEncoding_strings);
+  (void) dummy;
+  int idx = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumName(
+      RateEncoding_entries,
+      RateEncoding_entries_by_number,
+      3, value);
+  return idx == -1 ? ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString() :
+                     RateEncoding_strings[idx].get();
+}
+bool RateEncoding_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RateEncoding* value) {
+  int int_value;
+  bool success = ::PROTOBUF_NAMESPACE_ID::internal::LookUpEnumValue(
+      RateEncoding_entries, 3, name, &int_value);
+  if (success) {
+    *value = static_cast<RateEncoding>(int_value);
+  }
+  return success;
 }
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_L2Summary_epoch_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_L2Summary_epoch_2eproto}, {}};
-
-namespace epoch {
-
 // ===================================================================
 
-void L2Summary::InitAsDefaultInstance() {
-}
 class L2Summary::_Internal {
  public:
 };
 
-L2Summary::L2Summary(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+L2Summary::L2Summary(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:epoch.L2Summary)
 }
 L2Summary::L2Summary(const L2Summary& from)
   : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  L2Summary* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mac_dst_){}
+    , decltype(_impl_.ipv4_){}
+    , decltype(_impl_.ipv6_){}
+    , decltype(_impl_.arp_){}
+    , decltype(_impl_.unknown_){}
+    , decltype(_impl_.dst_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
-  ::memcpy(&mac_dst_, &from.mac_dst_,
-    static_cast<size_t>(reinterpret_cast<char*>(&unknown_) -
-    reinterpret_cast<char*>(&mac_dst_)) + sizeof(unknown_));
+  ::memcpy(&_impl_.mac_dst_, &from._impl_.mac_dst_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.dst_id_) -
+    reinterpret_cast<char*>(&_impl_.mac_dst_)) + sizeof(_impl_.dst_id_));
   // @@protoc_insertion_point(copy_constructor:epoch.L2Summary)
 }
 
-void L2Summary::SharedCtor() {
-  ::memset(&mac_dst_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&unknown_) -
-      reinterpret_cast<char*>(&mac_dst_)) + sizeof(unknown_));
+inline void L2Summary::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mac_dst_){uint64_t{0u}}
+    , decltype(_impl_.ipv4_){0u}
+    , decltype(_impl_.ipv6_){0u}
+    , decltype(_impl_.arp_){0u}
+    , decltype(_impl_.unknown_){0u}
+    , decltype(_impl_.dst_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 L2Summary::~L2Summary() {
   // @@protoc_insertion_point(destructor:epoch.L2Summary)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<std::string>();
 }
 
-void L2Summary::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void L2Summary::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void L2Summary::ArenaDtor(void* object) {
-  L2Summary* _this = reinterpret_cast< L2Summary* >(object);
-  (void)_this;
-}
-void L2Summary::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void L2Summary::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const L2Summary& L2Summary::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_L2Summary_epoch_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void L2Summary::Clear() {
 // @@protoc_insertion_point(message_clear_start:epoch.L2Summary)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&mac_dst_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&unknown_) -
-      reinterpret_cast<char*>(&mac_dst_)) + sizeof(unknown_));
+  ::memset(&_impl_.mac_dst_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.dst_id_) -
+      reinterpret_cast<char*>(&_impl_.mac_dst_)) + sizeof(_impl_.dst_id_));
   _internal_metadata_.Clear<std::string>();
 }
 
-const char* L2Summary::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* L2Summary::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // fixed64 mac_dst = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 9)) {
-          mac_dst_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr);
-          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint64);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.mac_dst_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
         continue;
       // uint32 ipv4 = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
-          ipv4_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.ipv4_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // uint32 ipv6 = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
-          ipv6_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.ipv6_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // uint32 arp = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
-          arp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.arp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // uint32 unknown = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
-          unknown_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.unknown_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<std::string>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+      // uint32 dst_id = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.dst_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* L2Summary::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* L2Summary::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:epoch.L2Summary)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // fixed64 mac_dst = 1;
-  if (this->mac_dst() != 0) {
+  if (this->_internal_mac_dst() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed64ToArray(1, this->_internal_mac_dst(), target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_mac_dst(), target);
   }
 
   // uint32 ipv4 = 2;
-  if (this->ipv4() != 0) {
+  if (this->_internal_ipv4() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(2, this->_internal_ipv4(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_ipv4(), target);
   }
 
   // uint32 ipv6 = 3;
-  if (this->ipv6() != 0) {
+  if (this->_internal_ipv6() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(3, this->_internal_ipv6(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_ipv6(), target);
   }
 
   // uint32 arp = 4;
-  if (this->arp() != 0) {
+  if (this->_internal_arp() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(4, this->_internal_arp(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_arp(), target);
   }
 
   // uint32 unknown = 5;
-  if (this->unknown() != 0) {
+  if (this->_internal_unknown() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt32ToArray(5, this->_internal_unknown(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_unknown(), target);
+  }
+
+  // uint32 dst_id = 6;
+  if (this->_internal_dst_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_dst_id(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -293,79 +405,80 @@ size_t L2Summary::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:epoch.L2Summary)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // fixed64 mac_dst = 1;
-  if (this->mac_dst() != 0) {
+  if (this->_internal_mac_dst() != 0) {
     total_size += 1 + 8;
   }
 
   // uint32 ipv4 = 2;
-  if (this->ipv4() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_ipv4());
+  if (this->_internal_ipv4() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ipv4());
   }
 
   // uint32 ipv6 = 3;
-  if (this->ipv6() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_ipv6());
+  if (this->_internal_ipv6() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_ipv6());
   }
 
   // uint32 arp = 4;
-  if (this->arp() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_arp());
+  if (this->_internal_arp() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_arp());
   }
 
   // uint32 unknown = 5;
-  if (this->unknown() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt32Size(
-        this->_internal_unknown());
+  if (this->_internal_unknown() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_unknown());
+  }
+
+  // uint32 dst_id = 6;
+  if (this->_internal_dst_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_dst_id());
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void L2Summary::CheckTypeAndMergeFrom(
     const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
-  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const L2Summary*>(
+  MergeFrom(*::_pbi::DownCast<const L2Summary*>(
       &from));
 }
 
 void L2Summary::MergeFrom(const L2Summary& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:epoch.L2Summary)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  L2Summary* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:epoch.L2Summary)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.mac_dst() != 0) {
-    _internal_set_mac_dst(from._internal_mac_dst());
+  if (from._internal_mac_dst() != 0) {
+    _this->_internal_set_mac_dst(from._internal_mac_dst());
   }
-  if (from.ipv4() != 0) {
-    _internal_set_ipv4(from._internal_ipv4());
+  if (from._internal_ipv4() != 0) {
+    _this->_internal_set_ipv4(from._internal_ipv4());
   }
-  if (from.ipv6() != 0) {
-    _internal_set_ipv6(from._internal_ipv6());
+  if (from._internal_ipv6() != 0) {
+    _this->_internal_set_ipv6(from._internal_ipv6());
   }
-  if (from.arp() != 0) {
-    _internal_set_arp(from._internal_arp());
+  if (from._internal_arp() != 0) {
+    _this->_internal_set_arp(from._internal_arp());
   }
-  if (from.unknown() != 0) {
-    _internal_set_unknown(from._internal_unknown());
+  if (from._internal_unknown() != 0) {
+    _this->_internal_set_unknown(from._internal_unknown());
   }
+  if (from._internal_dst_id() != 0) {
+    _this->_internal_set_dst_id(from._internal_dst_id());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void L2Summary::CopyFrom(const L2Summary& from) {
@@ -381,13 +494,13 @@ bool L2Summary::IsInitialized() const {
 
 void L2Summary::InternalSwap(L2Summary* other) {
   using std::swap;
-  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(L2Summary, unknown_)
-      + sizeof(L2Summary::unknown_)
-      - PROTOBUF_FIELD_OFFSET(L2Summary, mac_dst_)>(
-          reinterpret_cast<char*>(&mac_dst_),
-          reinterpret_cast<char*>(&other->mac_dst_));
+      PROTOBUF_FIELD_OFFSET(L2Summary, _impl_.dst_id_)
+      + sizeof(L2Summary::_impl_.dst_id_)
+      - PROTOBUF_FIELD_OFFSET(L2Summary, _impl_.mac_dst_)>(
+          reinterpret_cast<char*>(&_impl_.mac_dst_),
+          reinterpret_cast<char*>(&other->_impl_.mac_dst_));
 }
 
 std::string L2Summary::GetTypeName() const {
@@ -397,16 +510,6 @@ std::string L2Summary::GetTypeName() const {
 
 // ===================================================================
 
-void DeviceComm::InitAsDefaultInstance() {
-  ::epoch::_DeviceComm_default_instance_._instance.get_mutable()->bcast_33_ = const_cast< ::epoch::L2Summary*>(
-      ::epoch::L2Summary::internal_default_instance());
-  ::epoch::_DeviceComm_default_instance_._instance.get_mutable()->bcast_ff_ = const_cast< ::epoch::L2Summary*>(
-      ::epoch::L2Summary::internal_default_instance());
-  ::epoch::_DeviceComm_default_instance_._instance.get_mutable()->bcast_01_ = const_cast< ::epoch::L2Summary*>(
-      ::epoch::L2Summary::internal_default_instance());
-  ::epoch::_DeviceComm_default_instance_._instance.get_mutable()->bcast_xx_ = const_cast< ::epoch::L2Summary*>(
-      ::epoch::L2Summary::internal_default_instance());
-}
 class DeviceComm::_Internal {
  public:
   static const ::epoch::L2Summary& bcast_33(const DeviceComm* msg);
@@ -417,136 +520,142 @@ class DeviceComm::_Internal {
 
 const ::epoch::L2Summary&
 DeviceComm::_Internal::bcast_33(const DeviceComm* msg) {
-  return *msg->bcast_33_;
+  return *msg->_impl_.bcast_33_;
 }
 const ::epoch::L2Summary&
 DeviceComm::_Internal::bcast_ff(const DeviceComm* msg) {
-  return *msg->bcast_ff_;
+  return *msg->_impl_.bcast_ff_;
 }
 const ::epoch::L2Summary&
 DeviceComm::_Internal::bcast_01(const DeviceComm* msg) {
-  return *msg->bcast_01_;
+  return *msg->_impl_.bcast_01_;
 }
 const ::epoch::L2Summary&
 DeviceComm::_Internal::bcast_xx(const DeviceComm* msg) {
-  return *msg->bcast_xx_;
+  return *msg->_impl_.bcast_xx_;
 }
-DeviceComm::DeviceComm(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena),
-  tx_summary_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+DeviceComm::DeviceComm(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:epoch.DeviceComm)
 }
 DeviceComm::DeviceComm(const DeviceComm& from)
-  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
-      tx_summary_(from.tx_summary_) {
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  DeviceComm* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tx_summary_){from._impl_.tx_summary_}
+    , decltype(_impl_.bcast_33_){nullptr}
+    , decltype(_impl_.bcast_ff_){nullptr}
+    , decltype(_impl_.bcast_01_){nullptr}
+    , decltype(_impl_.bcast_xx_){nullptr}
+    , decltype(_impl_.mac_src_){}
+    , decltype(_impl_.src_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
   if (from._internal_has_bcast_33()) {
-    bcast_33_ = new ::epoch::L2Summary(*from.bcast_33_);
-  } else {
-    bcast_33_ = nullptr;
+    _this->_impl_.bcast_33_ = new ::epoch::L2Summary(*from._impl_.bcast_33_);
   }
   if (from._internal_has_bcast_ff()) {
-    bcast_ff_ = new ::epoch::L2Summary(*from.bcast_ff_);
-  } else {
-    bcast_ff_ = nullptr;
+    _this->_impl_.bcast_ff_ = new ::epoch::L2Summary(*from._impl_.bcast_ff_);
   }
   if (from._internal_has_bcast_01()) {
-    bcast_01_ = new ::epoch::L2Summary(*from.bcast_01_);
-  } else {
-    bcast_01_ = nullptr;
+    _this->_impl_.bcast_01_ = new ::epoch::L2Summary(*from._impl_.bcast_01_);
   }
   if (from._internal_has_bcast_xx()) {
-    bcast_xx_ = new ::epoch::L2Summary(*from.bcast_xx_);
-  } else {
-    bcast_xx_ = nullptr;
+    _this->_impl_.bcast_xx_ = new ::epoch::L2Summary(*from._impl_.bcast_xx_);
   }
-  mac_src_ = from.mac_src_;
+  ::memcpy(&_impl_.mac_src_, &from._impl_.mac_src_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.src_id_) -
+    reinterpret_cast<char*>(&_impl_.mac_src_)) + sizeof(_impl_.src_id_));
   // @@protoc_insertion_point(copy_constructor:epoch.DeviceComm)
 }
 
-void DeviceComm::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_DeviceComm_epoch_2eproto.base);
-  ::memset(&bcast_33_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&mac_src_) -
-      reinterpret_cast<char*>(&bcast_33_)) + sizeof(mac_src_));
+inline void DeviceComm::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.tx_summary_){arena}
+    , decltype(_impl_.bcast_33_){nullptr}
+    , decltype(_impl_.bcast_ff_){nullptr}
+    , decltype(_impl_.bcast_01_){nullptr}
+    , decltype(_impl_.bcast_xx_){nullptr}
+    , decltype(_impl_.mac_src_){uint64_t{0u}}
+    , decltype(_impl_.src_id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 DeviceComm::~DeviceComm() {
   // @@protoc_insertion_point(destructor:epoch.DeviceComm)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<std::string>();
 }
 
-void DeviceComm::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete bcast_33_;
-  if (this != internal_default_instance()) delete bcast_ff_;
-  if (this != internal_default_instance()) delete bcast_01_;
-  if (this != internal_default_instance()) delete bcast_xx_;
+inline void DeviceComm::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.tx_summary_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.bcast_33_;
+  if (this != internal_default_instance()) delete _impl_.bcast_ff_;
+  if (this != internal_default_instance()) delete _impl_.bcast_01_;
+  if (this != internal_default_instance()) delete _impl_.bcast_xx_;
 }
 
-void DeviceComm::ArenaDtor(void* object) {
-  DeviceComm* _this = reinterpret_cast< DeviceComm* >(object);
-  (void)_this;
-}
-void DeviceComm::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void DeviceComm::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const DeviceComm& DeviceComm::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_DeviceComm_epoch_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void DeviceComm::Clear() {
 // @@protoc_insertion_point(message_clear_start:epoch.DeviceComm)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  tx_summary_.Clear();
-  if (GetArena() == nullptr && bcast_33_ != nullptr) {
-    delete bcast_33_;
+  _impl_.tx_summary_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.bcast_33_ != nullptr) {
+    delete _impl_.bcast_33_;
   }
-  bcast_33_ = nullptr;
-  if (GetArena() == nullptr && bcast_ff_ != nullptr) {
-    delete bcast_ff_;
+  _impl_.bcast_33_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.bcast_ff_ != nullptr) {
+    delete _impl_.bcast_ff_;
   }
-  bcast_ff_ = nullptr;
-  if (GetArena() == nullptr && bcast_01_ != nullptr) {
-    delete bcast_01_;
+  _impl_.bcast_ff_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.bcast_01_ != nullptr) {
+    delete _impl_.bcast_01_;
   }
-  bcast_01_ = nullptr;
-  if (GetArena() == nullptr && bcast_xx_ != nullptr) {
-    delete bcast_xx_;
+  _impl_.bcast_01_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.bcast_xx_ != nullptr) {
+    delete _impl_.bcast_xx_;
   }
-  bcast_xx_ = nullptr;
-  mac_src_ = PROTOBUF_ULONGLONG(0);
+  _impl_.bcast_xx_ = nullptr;
+  ::memset(&_impl_.mac_src_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.src_id_) -
+      reinterpret_cast<char*>(&_impl_.mac_src_)) + sizeof(_impl_.src_id_));
   _internal_metadata_.Clear<std::string>();
 }
 
-const char* DeviceComm::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* DeviceComm::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // fixed64 mac_src = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 9)) {
-          mac_src_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr);
-          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint64);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.mac_src_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
         continue;
       // repeated .epoch.L2Summary tx_summary = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -554,108 +663,124 @@ const char* DeviceComm::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID:
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .epoch.L2Summary bcast_33 = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           ptr = ctx->ParseMessage(_internal_mutable_bcast_33(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .epoch.L2Summary bcast_ff = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           ptr = ctx->ParseMessage(_internal_mutable_bcast_ff(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // .epoch.L2Summary bcast_01 = 5;
       case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
           ptr = ctx->ParseMessage(_internal_mutable_bcast_01(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      // .epoch.L2Summary bcast_XX = 6;
+      // .epoch.L2Summary bcast_xx = 6;
       case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
           ptr = ctx->ParseMessage(_internal_mutable_bcast_xx(), ptr);
           CHK_(ptr);
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<std::string>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+      // uint32 src_id = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.src_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* DeviceComm::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* DeviceComm::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:epoch.DeviceComm)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // fixed64 mac_src = 1;
-  if (this->mac_src() != 0) {
+  if (this->_internal_mac_src() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed64ToArray(1, this->_internal_mac_src(), target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_mac_src(), target);
   }
 
   // repeated .epoch.L2Summary tx_summary = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_tx_summary_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_tx_summary_size()); i < n; i++) {
+    const auto& repfield = this->_internal_tx_summary(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, this->_internal_tx_summary(i), target, stream);
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // .epoch.L2Summary bcast_33 = 3;
-  if (this->has_bcast_33()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_bcast_33()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        3, _Internal::bcast_33(this), target, stream);
+      InternalWriteMessage(3, _Internal::bcast_33(this),
+        _Internal::bcast_33(this).GetCachedSize(), target, stream);
   }
 
   // .epoch.L2Summary bcast_ff = 4;
-  if (this->has_bcast_ff()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_bcast_ff()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        4, _Internal::bcast_ff(this), target, stream);
+      InternalWriteMessage(4, _Internal::bcast_ff(this),
+        _Internal::bcast_ff(this).GetCachedSize(), target, stream);
   }
 
   // .epoch.L2Summary bcast_01 = 5;
-  if (this->has_bcast_01()) {
-    target = stream->EnsureSpace(target);
+  if (this->_internal_has_bcast_01()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        5, _Internal::bcast_01(this), target, stream);
+      InternalWriteMessage(5, _Internal::bcast_01(this),
+        _Internal::bcast_01(this).GetCachedSize(), target, stream);
   }
 
-  // .epoch.L2Summary bcast_XX = 6;
-  if (this->has_bcast_xx()) {
-    target = stream->EnsureSpace(target);
+  // .epoch.L2Summary bcast_xx = 6;
+  if (this->_internal_has_bcast_xx()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        6, _Internal::bcast_xx(this), target, stream);
+      InternalWriteMessage(6, _Internal::bcast_xx(this),
+        _Internal::bcast_xx(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 src_id = 7;
+  if (this->_internal_src_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_src_id(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -670,87 +795,100 @@ size_t DeviceComm::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:epoch.DeviceComm)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .epoch.L2Summary tx_summary = 2;
   total_size += 1UL * this->_internal_tx_summary_size();
-  for (const auto& msg : this->tx_summary_) {
+  for (const auto& msg : this->_impl_.tx_summary_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // .epoch.L2Summary bcast_33 = 3;
-  if (this->has_bcast_33()) {
+  if (this->_internal_has_bcast_33()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *bcast_33_);
+        *_impl_.bcast_33_);
   }
 
   // .epoch.L2Summary bcast_ff = 4;
-  if (this->has_bcast_ff()) {
+  if (this->_internal_has_bcast_ff()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *bcast_ff_);
+        *_impl_.bcast_ff_);
   }
 
   // .epoch.L2Summary bcast_01 = 5;
-  if (this->has_bcast_01()) {
+  if (this->_internal_has_bcast_01()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *bcast_01_);
+        *_impl_.bcast_01_);
   }
 
-  // .epoch.L2Summary bcast_XX = 6;
-  if (this->has_bcast_xx()) {
+  // .epoch.L2Summary bcast_xx = 6;
+  if (this->_internal_has_bcast_xx()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *bcast_xx_);
+        *_impl_.bcast_xx_);
   }
 
   // fixed64 mac_src = 1;
-  if (this->mac_src() != 0) {
+  if (this->_internal_mac_src() != 0) {
     total_size += 1 + 8;
   }
 
+  // uint32 src_id = 7;
+  if (this->_internal_src_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_src_id());
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void DeviceComm::CheckTypeAndMergeFrom(
     const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
-  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const DeviceComm*>(
+  MergeFrom(*::_pbi::DownCast<const DeviceComm*>(
       &from));
 }
 
 void DeviceComm::MergeFrom(const DeviceComm& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:epoch.DeviceComm)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  DeviceComm* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:epoch.DeviceComm)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  tx_summary_.MergeFrom(from.tx_summary_);
-  if (from.has_bcast_33()) {
-    _internal_mutable_bcast_33()->::epoch::L2Summary::MergeFrom(from._internal_bcast_33());
+  _this->_impl_.tx_summary_.MergeFrom(from._impl_.tx_summary_);
+  if (from._internal_has_bcast_33()) {
+    _this->_internal_mutable_bcast_33()->::epoch::L2Summary::MergeFrom(
+        from._internal_bcast_33());
   }
-  if (from.has_bcast_ff()) {
-    _internal_mutable_bcast_ff()->::epoch::L2Summary::MergeFrom(from._internal_bcast_ff());
+  if (from._internal_has_bcast_ff()) {
+    _this->_internal_mutable_bcast_ff()->::epoch::L2Summary::MergeFrom(
+        from._internal_bcast_ff());
+  }
+  if (from._internal_has_bcast_01()) {
+    _this->_internal_mutable_bcast_01()->::epoch::L2Summary::MergeFrom(
+        from._internal_bcast_01());
   }
-  if (from.has_bcast_01()) {
-    _internal_mutable_bcast_01()->::epoch::L2Summary::MergeFrom(from._internal_bcast_01());
+  if (from._internal_has_bcast_xx()) {
+    _this->_internal_mutable_bcast_xx()->::epoch::L2Summary::MergeFrom(
+        from._internal_bcast_xx());
   }
-  if (from.has_bcast_xx()) {
-    _internal_mutable_bcast_xx()->::epoch::L2Summary::MergeFrom(from._internal_bcast_xx());
+  if (from._internal_mac_src() != 0) {
+    _this->_internal_set_mac_src(from._internal_mac_src());
   }
-  if (from.mac_src() != 0) {
-    _internal_set_mac_src(from._internal_mac_src());
+  if (from._internal_src_id() != 0) {
+    _this->_internal_set_src_id(from._internal_src_id());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void DeviceComm::CopyFrom(const DeviceComm& from) {
@@ -766,14 +904,14 @@ bool DeviceComm::IsInitialized() const {
 
 void DeviceComm::InternalSwap(DeviceComm* other) {
   using std::swap;
-  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
-  tx_summary_.InternalSwap(&other->tx_summary_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.tx_summary_.InternalSwap(&other->_impl_.tx_summary_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(DeviceComm, mac_src_)
-      + sizeof(DeviceComm::mac_src_)
-      - PROTOBUF_FIELD_OFFSET(DeviceComm, bcast_33_)>(
-          reinterpret_cast<char*>(&bcast_33_),
-          reinterpret_cast<char*>(&other->bcast_33_));
+      PROTOBUF_FIELD_OFFSET(DeviceComm, _impl_.src_id_)
+      + sizeof(DeviceComm::_impl_.src_id_)
+      - PROTOBUF_FIELD_OFFSET(DeviceComm, _impl_.bcast_33_)>(
+          reinterpret_cast<char*>(&_impl_.bcast_33_),
+          reinterpret_cast<char*>(&other->_impl_.bcast_33_));
 }
 
 std::string DeviceComm::GetTypeName() const {
@@ -783,130 +921,148 @@ std::string DeviceComm::GetTypeName() const {
 
 // ===================================================================
 
-void AddrAssoc::InitAsDefaultInstance() {
-}
 class AddrAssoc::_Internal {
  public:
 };
 
-AddrAssoc::AddrAssoc(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+AddrAssoc::AddrAssoc(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:epoch.AddrAssoc)
 }
 AddrAssoc::AddrAssoc(const AddrAssoc& from)
   : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  AddrAssoc* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mac_src_){}
+    , decltype(_impl_.ipv4_){}
+    , decltype(_impl_.id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
-  ::memcpy(&mac_src_, &from.mac_src_,
-    static_cast<size_t>(reinterpret_cast<char*>(&ipv4_) -
-    reinterpret_cast<char*>(&mac_src_)) + sizeof(ipv4_));
+  ::memcpy(&_impl_.mac_src_, &from._impl_.mac_src_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.id_) -
+    reinterpret_cast<char*>(&_impl_.mac_src_)) + sizeof(_impl_.id_));
   // @@protoc_insertion_point(copy_constructor:epoch.AddrAssoc)
 }
 
-void AddrAssoc::SharedCtor() {
-  ::memset(&mac_src_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&ipv4_) -
-      reinterpret_cast<char*>(&mac_src_)) + sizeof(ipv4_));
+inline void AddrAssoc::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.mac_src_){uint64_t{0u}}
+    , decltype(_impl_.ipv4_){0u}
+    , decltype(_impl_.id_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 AddrAssoc::~AddrAssoc() {
   // @@protoc_insertion_point(destructor:epoch.AddrAssoc)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<std::string>();
 }
 
-void AddrAssoc::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void AddrAssoc::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
 }
 
-void AddrAssoc::ArenaDtor(void* object) {
-  AddrAssoc* _this = reinterpret_cast< AddrAssoc* >(object);
-  (void)_this;
-}
-void AddrAssoc::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void AddrAssoc::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const AddrAssoc& AddrAssoc::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_AddrAssoc_epoch_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void AddrAssoc::Clear() {
 // @@protoc_insertion_point(message_clear_start:epoch.AddrAssoc)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  ::memset(&mac_src_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&ipv4_) -
-      reinterpret_cast<char*>(&mac_src_)) + sizeof(ipv4_));
+  ::memset(&_impl_.mac_src_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.id_) -
+      reinterpret_cast<char*>(&_impl_.mac_src_)) + sizeof(_impl_.id_));
   _internal_metadata_.Clear<std::string>();
 }
 
-const char* AddrAssoc::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* AddrAssoc::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // fixed64 mac_src = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 9)) {
-          mac_src_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr);
-          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint64);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.mac_src_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
         continue;
       // fixed32 ipv4 = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 21)) {
-          ipv4_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint32>(ptr);
-          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint32);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 21)) {
+          _impl_.ipv4_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint32_t>(ptr);
+          ptr += sizeof(uint32_t);
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<std::string>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+      // uint32 id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
         continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* AddrAssoc::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* AddrAssoc::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:epoch.AddrAssoc)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // fixed64 mac_src = 1;
-  if (this->mac_src() != 0) {
+  if (this->_internal_mac_src() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed64ToArray(1, this->_internal_mac_src(), target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_mac_src(), target);
   }
 
   // fixed32 ipv4 = 2;
-  if (this->ipv4() != 0) {
+  if (this->_internal_ipv4() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed32ToArray(2, this->_internal_ipv4(), target);
+    target = ::_pbi::WireFormatLite::WriteFixed32ToArray(2, this->_internal_ipv4(), target);
+  }
+
+  // uint32 id = 3;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_id(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -921,47 +1077,56 @@ size_t AddrAssoc::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:epoch.AddrAssoc)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // fixed64 mac_src = 1;
-  if (this->mac_src() != 0) {
+  if (this->_internal_mac_src() != 0) {
     total_size += 1 + 8;
   }
 
   // fixed32 ipv4 = 2;
-  if (this->ipv4() != 0) {
+  if (this->_internal_ipv4() != 0) {
     total_size += 1 + 4;
   }
 
+  // uint32 id = 3;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void AddrAssoc::CheckTypeAndMergeFrom(
     const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
-  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const AddrAssoc*>(
+  MergeFrom(*::_pbi::DownCast<const AddrAssoc*>(
       &from));
 }
 
 void AddrAssoc::MergeFrom(const AddrAssoc& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:epoch.AddrAssoc)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  AddrAssoc* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:epoch.AddrAssoc)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.mac_src() != 0) {
-    _internal_set_mac_src(from._internal_mac_src());
+  if (from._internal_mac_src() != 0) {
+    _this->_internal_set_mac_src(from._internal_mac_src());
+  }
+  if (from._internal_ipv4() != 0) {
+    _this->_internal_set_ipv4(from._internal_ipv4());
   }
-  if (from.ipv4() != 0) {
-    _internal_set_ipv4(from._internal_ipv4());
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void AddrAssoc::CopyFrom(const AddrAssoc& from) {
@@ -977,13 +1142,13 @@ bool AddrAssoc::IsInitialized() const {
 
 void AddrAssoc::InternalSwap(AddrAssoc* other) {
   using std::swap;
-  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(AddrAssoc, ipv4_)
-      + sizeof(AddrAssoc::ipv4_)
-      - PROTOBUF_FIELD_OFFSET(AddrAssoc, mac_src_)>(
-          reinterpret_cast<char*>(&mac_src_),
-          reinterpret_cast<char*>(&other->mac_src_));
+      PROTOBUF_FIELD_OFFSET(AddrAssoc, _impl_.id_)
+      + sizeof(AddrAssoc::_impl_.id_)
+      - PROTOBUF_FIELD_OFFSET(AddrAssoc, _impl_.mac_src_)>(
+          reinterpret_cast<char*>(&_impl_.mac_src_),
+          reinterpret_cast<char*>(&other->_impl_.mac_src_));
 }
 
 std::string AddrAssoc::GetTypeName() const {
@@ -993,86 +1158,86 @@ std::string AddrAssoc::GetTypeName() const {
 
 // ===================================================================
 
-void ArpAssoc::InitAsDefaultInstance() {
-}
 class ArpAssoc::_Internal {
  public:
 };
 
-ArpAssoc::ArpAssoc(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena),
-  table_row_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+ArpAssoc::ArpAssoc(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:epoch.ArpAssoc)
 }
 ArpAssoc::ArpAssoc(const ArpAssoc& from)
-  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
-      table_row_(from.table_row_) {
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  ArpAssoc* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.table_row_){from._impl_.table_row_}
+    , decltype(_impl_.mac_src_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
-  mac_src_ = from.mac_src_;
+  _this->_impl_.mac_src_ = from._impl_.mac_src_;
   // @@protoc_insertion_point(copy_constructor:epoch.ArpAssoc)
 }
 
-void ArpAssoc::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_ArpAssoc_epoch_2eproto.base);
-  mac_src_ = PROTOBUF_ULONGLONG(0);
+inline void ArpAssoc::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.table_row_){arena}
+    , decltype(_impl_.mac_src_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
 }
 
 ArpAssoc::~ArpAssoc() {
   // @@protoc_insertion_point(destructor:epoch.ArpAssoc)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<std::string>();
 }
 
-void ArpAssoc::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void ArpAssoc::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.table_row_.~RepeatedPtrField();
 }
 
-void ArpAssoc::ArenaDtor(void* object) {
-  ArpAssoc* _this = reinterpret_cast< ArpAssoc* >(object);
-  (void)_this;
-}
-void ArpAssoc::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void ArpAssoc::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
+  _impl_._cached_size_.Set(size);
 }
-const ArpAssoc& ArpAssoc::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_ArpAssoc_epoch_2eproto.base);
-  return *internal_default_instance();
-}
-
 
 void ArpAssoc::Clear() {
 // @@protoc_insertion_point(message_clear_start:epoch.ArpAssoc)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  table_row_.Clear();
-  mac_src_ = PROTOBUF_ULONGLONG(0);
+  _impl_.table_row_.Clear();
+  _impl_.mac_src_ = uint64_t{0u};
   _internal_metadata_.Clear<std::string>();
 }
 
-const char* ArpAssoc::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* ArpAssoc::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // fixed64 mac_src = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 9)) {
-          mac_src_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr);
-          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint64);
-        } else goto handle_unusual;
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.mac_src_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr);
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
         continue;
       // repeated .epoch.AddrAssoc table_row = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -1080,48 +1245,50 @@ const char* ArpAssoc::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::i
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<std::string>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* ArpAssoc::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* ArpAssoc::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:epoch.ArpAssoc)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // fixed64 mac_src = 1;
-  if (this->mac_src() != 0) {
+  if (this->_internal_mac_src() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteFixed64ToArray(1, this->_internal_mac_src(), target);
+    target = ::_pbi::WireFormatLite::WriteFixed64ToArray(1, this->_internal_mac_src(), target);
   }
 
   // repeated .epoch.AddrAssoc table_row = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_table_row_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_table_row_size()); i < n; i++) {
+    const auto& repfield = this->_internal_table_row(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, this->_internal_table_row(i), target, stream);
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -1136,47 +1303,48 @@ size_t ArpAssoc::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:epoch.ArpAssoc)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   // repeated .epoch.AddrAssoc table_row = 2;
   total_size += 1UL * this->_internal_table_row_size();
-  for (const auto& msg : this->table_row_) {
+  for (const auto& msg : this->_impl_.table_row_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // fixed64 mac_src = 1;
-  if (this->mac_src() != 0) {
+  if (this->_internal_mac_src() != 0) {
     total_size += 1 + 8;
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void ArpAssoc::CheckTypeAndMergeFrom(
     const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
-  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const ArpAssoc*>(
+  MergeFrom(*::_pbi::DownCast<const ArpAssoc*>(
       &from));
 }
 
 void ArpAssoc::MergeFrom(const ArpAssoc& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:epoch.ArpAssoc)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  ArpAssoc* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:epoch.ArpAssoc)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  table_row_.MergeFrom(from.table_row_);
-  if (from.mac_src() != 0) {
-    _internal_set_mac_src(from._internal_mac_src());
+  _this->_impl_.table_row_.MergeFrom(from._impl_.table_row_);
+  if (from._internal_mac_src() != 0) {
+    _this->_internal_set_mac_src(from._internal_mac_src());
   }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void ArpAssoc::CopyFrom(const ArpAssoc& from) {
@@ -1192,9 +1360,9 @@ bool ArpAssoc::IsInitialized() const {
 
 void ArpAssoc::InternalSwap(ArpAssoc* other) {
   using std::swap;
-  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
-  table_row_.InternalSwap(&other->table_row_);
-  swap(mac_src_, other->mac_src_);
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.table_row_.InternalSwap(&other->_impl_.table_row_);
+  swap(_impl_.mac_src_, other->_impl_.mac_src_);
 }
 
 std::string ArpAssoc::GetTypeName() const {
@@ -1204,95 +1372,795 @@ std::string ArpAssoc::GetTypeName() const {
 
 // ===================================================================
 
-void EpochStep::InitAsDefaultInstance() {
+class L2Columns::_Internal {
+ public:
+};
+
+L2Columns::L2Columns(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:epoch.L2Columns)
+}
+L2Columns::L2Columns(const L2Columns& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  L2Columns* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.src_id_){from._impl_.src_id_}
+    , /*decltype(_impl_._src_id_cached_byte_size_)*/{0}
+    , decltype(_impl_.dst_id_){from._impl_.dst_id_}
+    , /*decltype(_impl_._dst_id_cached_byte_size_)*/{0}
+    , decltype(_impl_.ipv4_){from._impl_.ipv4_}
+    , /*decltype(_impl_._ipv4_cached_byte_size_)*/{0}
+    , decltype(_impl_.ipv6_){from._impl_.ipv6_}
+    , /*decltype(_impl_._ipv6_cached_byte_size_)*/{0}
+    , decltype(_impl_.arp_){from._impl_.arp_}
+    , /*decltype(_impl_._arp_cached_byte_size_)*/{0}
+    , decltype(_impl_.unknown_){from._impl_.unknown_}
+    , /*decltype(_impl_._unknown_cached_byte_size_)*/{0}
+    , decltype(_impl_.bcast_src_id_){from._impl_.bcast_src_id_}
+    , /*decltype(_impl_._bcast_src_id_cached_byte_size_)*/{0}
+    , decltype(_impl_.bcast_pool_){from._impl_.bcast_pool_}
+    , /*decltype(_impl_._bcast_pool_cached_byte_size_)*/{0}
+    , decltype(_impl_.bcast_ipv4_){from._impl_.bcast_ipv4_}
+    , /*decltype(_impl_._bcast_ipv4_cached_byte_size_)*/{0}
+    , decltype(_impl_.bcast_ipv6_){from._impl_.bcast_ipv6_}
+    , /*decltype(_impl_._bcast_ipv6_cached_byte_size_)*/{0}
+    , decltype(_impl_.bcast_arp_){from._impl_.bcast_arp_}
+    , /*decltype(_impl_._bcast_arp_cached_byte_size_)*/{0}
+    , decltype(_impl_.bcast_unknown_){from._impl_.bcast_unknown_}
+    , /*decltype(_impl_._bcast_unknown_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:epoch.L2Columns)
+}
+
+inline void L2Columns::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.src_id_){arena}
+    , /*decltype(_impl_._src_id_cached_byte_size_)*/{0}
+    , decltype(_impl_.dst_id_){arena}
+    , /*decltype(_impl_._dst_id_cached_byte_size_)*/{0}
+    , decltype(_impl_.ipv4_){arena}
+    , /*decltype(_impl_._ipv4_cached_byte_size_)*/{0}
+    , decltype(_impl_.ipv6_){arena}
+    , /*decltype(_impl_._ipv6_cached_byte_size_)*/{0}
+    , decltype(_impl_.arp_){arena}
+    , /*decltype(_impl_._arp_cached_byte_size_)*/{0}
+    , decltype(_impl_.unknown_){arena}
+    , /*decltype(_impl_._unknown_cached_byte_size_)*/{0}
+    , decltype(_impl_.bcast_src_id_){arena}
+    , /*decltype(_impl_._bcast_src_id_cached_byte_size_)*/{0}
+    , decltype(_impl_.bcast_pool_){arena}
+    , /*decltype(_impl_._bcast_pool_cached_byte_size_)*/{0}
+    , decltype(_impl_.bcast_ipv4_){arena}
+    , /*decltype(_impl_._bcast_ipv4_cached_byte_size_)*/{0}
+    , decltype(_impl_.bcast_ipv6_){arena}
+    , /*decltype(_impl_._bcast_ipv6_cached_byte_size_)*/{0}
+    , decltype(_impl_.bcast_arp_){arena}
+    , /*decltype(_impl_._bcast_arp_cached_byte_size_)*/{0}
+    , decltype(_impl_.bcast_unknown_){arena}
+    , /*decltype(_impl_._bcast_unknown_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+L2Columns::~L2Columns() {
+  // @@protoc_insertion_point(destructor:epoch.L2Columns)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void L2Columns::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.src_id_.~RepeatedField();
+  _impl_.dst_id_.~RepeatedField();
+  _impl_.ipv4_.~RepeatedField();
+  _impl_.ipv6_.~RepeatedField();
+  _impl_.arp_.~RepeatedField();
+  _impl_.unknown_.~RepeatedField();
+  _impl_.bcast_src_id_.~RepeatedField();
+  _impl_.bcast_pool_.~RepeatedField();
+  _impl_.bcast_ipv4_.~RepeatedField();
+  _impl_.bcast_ipv6_.~RepeatedField();
+  _impl_.bcast_arp_.~RepeatedField();
+  _impl_.bcast_unknown_.~RepeatedField();
+}
+
+void L2Columns::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void L2Columns::Clear() {
+// @@protoc_insertion_point(message_clear_start:epoch.L2Columns)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.src_id_.Clear();
+  _impl_.dst_id_.Clear();
+  _impl_.ipv4_.Clear();
+  _impl_.ipv6_.Clear();
+  _impl_.arp_.Clear();
+  _impl_.unknown_.Clear();
+  _impl_.bcast_src_id_.Clear();
+  _impl_.bcast_pool_.Clear();
+  _impl_.bcast_ipv4_.Clear();
+  _impl_.bcast_ipv6_.Clear();
+  _impl_.bcast_arp_.Clear();
+  _impl_.bcast_unknown_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* L2Columns::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 src_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_src_id(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_src_id(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 dst_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_dst_id(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_dst_id(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 ipv4 = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_ipv4(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_ipv4(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 ipv6 = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_ipv6(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_ipv6(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 arp = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_arp(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 40) {
+          _internal_add_arp(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 unknown = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_unknown(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 48) {
+          _internal_add_unknown(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 bcast_src_id = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_bcast_src_id(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 56) {
+          _internal_add_bcast_src_id(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 bcast_pool = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_bcast_pool(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 64) {
+          _internal_add_bcast_pool(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 bcast_ipv4 = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_bcast_ipv4(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 72) {
+          _internal_add_bcast_ipv4(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 bcast_ipv6 = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_bcast_ipv6(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 80) {
+          _internal_add_bcast_ipv6(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 bcast_arp = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_bcast_arp(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 88) {
+          _internal_add_bcast_arp(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 bcast_unknown = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_bcast_unknown(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 96) {
+          _internal_add_bcast_unknown(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* L2Columns::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:epoch.L2Columns)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 src_id = 1;
+  {
+    int byte_size = _impl_._src_id_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_src_id(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 dst_id = 2;
+  {
+    int byte_size = _impl_._dst_id_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          2, _internal_dst_id(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 ipv4 = 3;
+  {
+    int byte_size = _impl_._ipv4_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          3, _internal_ipv4(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 ipv6 = 4;
+  {
+    int byte_size = _impl_._ipv6_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          4, _internal_ipv6(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 arp = 5;
+  {
+    int byte_size = _impl_._arp_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          5, _internal_arp(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 unknown = 6;
+  {
+    int byte_size = _impl_._unknown_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          6, _internal_unknown(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 bcast_src_id = 7;
+  {
+    int byte_size = _impl_._bcast_src_id_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          7, _internal_bcast_src_id(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 bcast_pool = 8;
+  {
+    int byte_size = _impl_._bcast_pool_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          8, _internal_bcast_pool(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 bcast_ipv4 = 9;
+  {
+    int byte_size = _impl_._bcast_ipv4_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          9, _internal_bcast_ipv4(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 bcast_ipv6 = 10;
+  {
+    int byte_size = _impl_._bcast_ipv6_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          10, _internal_bcast_ipv6(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 bcast_arp = 11;
+  {
+    int byte_size = _impl_._bcast_arp_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          11, _internal_bcast_arp(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 bcast_unknown = 12;
+  {
+    int byte_size = _impl_._bcast_unknown_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          12, _internal_bcast_unknown(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:epoch.L2Columns)
+  return target;
+}
+
+size_t L2Columns::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:epoch.L2Columns)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 src_id = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.src_id_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._src_id_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 dst_id = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.dst_id_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._dst_id_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 ipv4 = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.ipv4_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._ipv4_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 ipv6 = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.ipv6_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._ipv6_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 arp = 5;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.arp_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._arp_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 unknown = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.unknown_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._unknown_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 bcast_src_id = 7;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.bcast_src_id_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._bcast_src_id_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 bcast_pool = 8;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.bcast_pool_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._bcast_pool_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 bcast_ipv4 = 9;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.bcast_ipv4_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._bcast_ipv4_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 bcast_ipv6 = 10;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.bcast_ipv6_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._bcast_ipv6_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 bcast_arp = 11;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.bcast_arp_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._bcast_arp_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 bcast_unknown = 12;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.bcast_unknown_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._bcast_unknown_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void L2Columns::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const L2Columns*>(
+      &from));
+}
+
+void L2Columns::MergeFrom(const L2Columns& from) {
+  L2Columns* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:epoch.L2Columns)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.src_id_.MergeFrom(from._impl_.src_id_);
+  _this->_impl_.dst_id_.MergeFrom(from._impl_.dst_id_);
+  _this->_impl_.ipv4_.MergeFrom(from._impl_.ipv4_);
+  _this->_impl_.ipv6_.MergeFrom(from._impl_.ipv6_);
+  _this->_impl_.arp_.MergeFrom(from._impl_.arp_);
+  _this->_impl_.unknown_.MergeFrom(from._impl_.unknown_);
+  _this->_impl_.bcast_src_id_.MergeFrom(from._impl_.bcast_src_id_);
+  _this->_impl_.bcast_pool_.MergeFrom(from._impl_.bcast_pool_);
+  _this->_impl_.bcast_ipv4_.MergeFrom(from._impl_.bcast_ipv4_);
+  _this->_impl_.bcast_ipv6_.MergeFrom(from._impl_.bcast_ipv6_);
+  _this->_impl_.bcast_arp_.MergeFrom(from._impl_.bcast_arp_);
+  _this->_impl_.bcast_unknown_.MergeFrom(from._impl_.bcast_unknown_);
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void L2Columns::CopyFrom(const L2Columns& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:epoch.L2Columns)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
 }
+
+bool L2Columns::IsInitialized() const {
+  return true;
+}
+
+void L2Columns::InternalSwap(L2Columns* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.src_id_.InternalSwap(&other->_impl_.src_id_);
+  _impl_.dst_id_.InternalSwap(&other->_impl_.dst_id_);
+  _impl_.ipv4_.InternalSwap(&other->_impl_.ipv4_);
+  _impl_.ipv6_.InternalSwap(&other->_impl_.ipv6_);
+  _impl_.arp_.InternalSwap(&other->_impl_.arp_);
+  _impl_.unknown_.InternalSwap(&other->_impl_.unknown_);
+  _impl_.bcast_src_id_.InternalSwap(&other->_impl_.bcast_src_id_);
+  _impl_.bcast_pool_.InternalSwap(&other->_impl_.bcast_pool_);
+  _impl_.bcast_ipv4_.InternalSwap(&other->_impl_.bcast_ipv4_);
+  _impl_.bcast_ipv6_.InternalSwap(&other->_impl_.bcast_ipv6_);
+  _impl_.bcast_arp_.InternalSwap(&other->_impl_.bcast_arp_);
+  _impl_.bcast_unknown_.InternalSwap(&other->_impl_.bcast_unknown_);
+}
+
+std::string L2Columns::GetTypeName() const {
+  return "epoch.L2Columns";
+}
+
+
+// ===================================================================
+
 class EpochStep::_Internal {
  public:
+  static const ::epoch::L2Columns& l2_columns(const EpochStep* msg);
 };
 
-EpochStep::EpochStep(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena),
-  enter_l2devices_(arena),
-  l2_dev_comm_(arena),
-  enter_l2_ipv4_addr_src_(arena),
-  enter_arp_table_(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
+const ::epoch::L2Columns&
+EpochStep::_Internal::l2_columns(const EpochStep* msg) {
+  return *msg->_impl_.l2_columns_;
+}
+EpochStep::EpochStep(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
   // @@protoc_insertion_point(arena_constructor:epoch.EpochStep)
 }
 EpochStep::EpochStep(const EpochStep& from)
-  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
-      enter_l2devices_(from.enter_l2devices_),
-      l2_dev_comm_(from.l2_dev_comm_),
-      enter_l2_ipv4_addr_src_(from.enter_l2_ipv4_addr_src_),
-      enter_arp_table_(from.enter_arp_table_) {
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  EpochStep* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.enter_l2devices_){from._impl_.enter_l2devices_}
+    , decltype(_impl_.l2_dev_comm_){from._impl_.l2_dev_comm_}
+    , decltype(_impl_.enter_l2_ipv4_addr_src_){from._impl_.enter_l2_ipv4_addr_src_}
+    , decltype(_impl_.enter_arp_table_){from._impl_.enter_arp_table_}
+    , decltype(_impl_.enter_l2device_ids_){from._impl_.enter_l2device_ids_}
+    , /*decltype(_impl_._enter_l2device_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.sensor_){}
+    , decltype(_impl_.l2_columns_){nullptr}
+    , decltype(_impl_.encoding_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.sensor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sensor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_sensor().empty()) {
+    _this->_impl_.sensor_.Set(from._internal_sensor(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_l2_columns()) {
+    _this->_impl_.l2_columns_ = new ::epoch::L2Columns(*from._impl_.l2_columns_);
+  }
+  _this->_impl_.encoding_ = from._impl_.encoding_;
   // @@protoc_insertion_point(copy_constructor:epoch.EpochStep)
 }
 
-void EpochStep::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_EpochStep_epoch_2eproto.base);
+inline void EpochStep::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.enter_l2devices_){arena}
+    , decltype(_impl_.l2_dev_comm_){arena}
+    , decltype(_impl_.enter_l2_ipv4_addr_src_){arena}
+    , decltype(_impl_.enter_arp_table_){arena}
+    , decltype(_impl_.enter_l2device_ids_){arena}
+    , /*decltype(_impl_._enter_l2device_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.sensor_){}
+    , decltype(_impl_.l2_columns_){nullptr}
+    , decltype(_impl_.encoding_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.sensor_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sensor_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 EpochStep::~EpochStep() {
   // @@protoc_insertion_point(destructor:epoch.EpochStep)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
   SharedDtor();
-  _internal_metadata_.Delete<std::string>();
 }
 
-void EpochStep::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
+inline void EpochStep::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.enter_l2devices_.~RepeatedField();
+  _impl_.l2_dev_comm_.~RepeatedPtrField();
+  _impl_.enter_l2_ipv4_addr_src_.~RepeatedPtrField();
+  _impl_.enter_arp_table_.~RepeatedPtrField();
+  _impl_.enter_l2device_ids_.~RepeatedField();
+  _impl_.sensor_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.l2_columns_;
 }
 
-void EpochStep::ArenaDtor(void* object) {
-  EpochStep* _this = reinterpret_cast< EpochStep* >(object);
-  (void)_this;
-}
-void EpochStep::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
 void EpochStep::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const EpochStep& EpochStep::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_EpochStep_epoch_2eproto.base);
-  return *internal_default_instance();
+  _impl_._cached_size_.Set(size);
 }
 
-
 void EpochStep::Clear() {
 // @@protoc_insertion_point(message_clear_start:epoch.EpochStep)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  enter_l2devices_.Clear();
-  l2_dev_comm_.Clear();
-  enter_l2_ipv4_addr_src_.Clear();
-  enter_arp_table_.Clear();
+  _impl_.enter_l2devices_.Clear();
+  _impl_.l2_dev_comm_.Clear();
+  _impl_.enter_l2_ipv4_addr_src_.Clear();
+  _impl_.enter_arp_table_.Clear();
+  _impl_.enter_l2device_ids_.Clear();
+  _impl_.sensor_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.l2_columns_ != nullptr) {
+    delete _impl_.l2_columns_;
+  }
+  _impl_.l2_columns_ = nullptr;
+  _impl_.encoding_ = 0;
   _internal_metadata_.Clear<std::string>();
 }
 
-const char* EpochStep::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* EpochStep::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
   while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
       // repeated fixed64 enter_l2devices = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(_internal_mutable_enter_l2devices(), ptr, ctx);
           CHK_(ptr);
-        } else if (static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 9) {
-          _internal_add_enter_l2devices(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<::PROTOBUF_NAMESPACE_ID::uint64>(ptr));
-          ptr += sizeof(::PROTOBUF_NAMESPACE_ID::uint64);
-        } else goto handle_unusual;
+        } else if (static_cast<uint8_t>(tag) == 9) {
+          _internal_add_enter_l2devices(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr));
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
         continue;
       // repeated .epoch.DeviceComm l2_dev_comm = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -1300,11 +2168,12 @@ const char* EpochStep::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .epoch.AddrAssoc enter_l2_ipv4_addr_src = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -1312,11 +2181,12 @@ const char* EpochStep::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
         continue;
       // repeated .epoch.ArpAssoc enter_arp_table = 4;
       case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
           ptr -= 1;
           do {
             ptr += 1;
@@ -1324,34 +2194,74 @@ const char* EpochStep::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
-        } else goto handle_unusual;
+        } else
+          goto handle_unusual;
+        continue;
+      // string sensor = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_sensor();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, nullptr));
+        } else
+          goto handle_unusual;
         continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<std::string>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
+      // .epoch.RateEncoding encoding = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_encoding(static_cast<::epoch::RateEncoding>(val));
+        } else
+          goto handle_unusual;
         continue;
-      }
+      // repeated uint32 enter_l2device_ids = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_enter_l2device_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 56) {
+          _internal_add_enter_l2device_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .epoch.L2Columns l2_columns = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_l2_columns(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
     }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
   }  // while
-success:
+message_done:
   return ptr;
 failure:
   ptr = nullptr;
-  goto success;
+  goto message_done;
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* EpochStep::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+uint8_t* EpochStep::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:epoch.EpochStep)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   // repeated fixed64 enter_l2devices = 1;
@@ -1360,27 +2270,60 @@ failure:
   }
 
   // repeated .epoch.DeviceComm l2_dev_comm = 2;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_l2_dev_comm_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_l2_dev_comm_size()); i < n; i++) {
+    const auto& repfield = this->_internal_l2_dev_comm(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, this->_internal_l2_dev_comm(i), target, stream);
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // repeated .epoch.AddrAssoc enter_l2_ipv4_addr_src = 3;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_enter_l2_ipv4_addr_src_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_enter_l2_ipv4_addr_src_size()); i < n; i++) {
+    const auto& repfield = this->_internal_enter_l2_ipv4_addr_src(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(3, this->_internal_enter_l2_ipv4_addr_src(i), target, stream);
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   // repeated .epoch.ArpAssoc enter_arp_table = 4;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_enter_arp_table_size()); i < n; i++) {
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_enter_arp_table_size()); i < n; i++) {
+    const auto& repfield = this->_internal_enter_arp_table(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // string sensor = 5;
+  if (!this->_internal_sensor().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_sensor().data(), static_cast<int>(this->_internal_sensor().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "epoch.EpochStep.sensor");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_sensor(), target);
+  }
+
+  // .epoch.RateEncoding encoding = 6;
+  if (this->_internal_encoding() != 0) {
     target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      6, this->_internal_encoding(), target);
+  }
+
+  // repeated uint32 enter_l2device_ids = 7;
+  {
+    int byte_size = _impl_._enter_l2device_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          7, _internal_enter_l2device_ids(), byte_size, target);
+    }
+  }
+
+  // .epoch.L2Columns l2_columns = 8;
+  if (this->_internal_has_l2_columns()) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(4, this->_internal_enter_arp_table(i), target, stream);
+      InternalWriteMessage(8, _Internal::l2_columns(this),
+        _Internal::l2_columns(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -1395,7 +2338,7 @@ size_t EpochStep::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:epoch.EpochStep)
   size_t total_size = 0;
 
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
@@ -1405,61 +2348,103 @@ size_t EpochStep::ByteSizeLong() const {
     size_t data_size = 8UL * count;
     if (data_size > 0) {
       total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-            static_cast<::PROTOBUF_NAMESPACE_ID::int32>(data_size));
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
     }
-    int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(data_size);
-    _enter_l2devices_cached_byte_size_.store(cached_size,
-                                    std::memory_order_relaxed);
     total_size += data_size;
   }
 
   // repeated .epoch.DeviceComm l2_dev_comm = 2;
   total_size += 1UL * this->_internal_l2_dev_comm_size();
-  for (const auto& msg : this->l2_dev_comm_) {
+  for (const auto& msg : this->_impl_.l2_dev_comm_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // repeated .epoch.AddrAssoc enter_l2_ipv4_addr_src = 3;
   total_size += 1UL * this->_internal_enter_l2_ipv4_addr_src_size();
-  for (const auto& msg : this->enter_l2_ipv4_addr_src_) {
+  for (const auto& msg : this->_impl_.enter_l2_ipv4_addr_src_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   // repeated .epoch.ArpAssoc enter_arp_table = 4;
   total_size += 1UL * this->_internal_enter_arp_table_size();
-  for (const auto& msg : this->enter_arp_table_) {
+  for (const auto& msg : this->_impl_.enter_arp_table_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  // repeated uint32 enter_l2device_ids = 7;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.enter_l2device_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._enter_l2device_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // string sensor = 5;
+  if (!this->_internal_sensor().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_sensor());
+  }
+
+  // .epoch.L2Columns l2_columns = 8;
+  if (this->_internal_has_l2_columns()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.l2_columns_);
+  }
+
+  // .epoch.RateEncoding encoding = 6;
+  if (this->_internal_encoding() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_encoding());
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
   }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  int cached_size = ::_pbi::ToCachedSize(total_size);
   SetCachedSize(cached_size);
   return total_size;
 }
 
 void EpochStep::CheckTypeAndMergeFrom(
     const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
-  MergeFrom(*::PROTOBUF_NAMESPACE_ID::internal::DownCast<const EpochStep*>(
+  MergeFrom(*::_pbi::DownCast<const EpochStep*>(
       &from));
 }
 
 void EpochStep::MergeFrom(const EpochStep& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:epoch.EpochStep)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  EpochStep* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:epoch.EpochStep)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  enter_l2devices_.MergeFrom(from.enter_l2devices_);
-  l2_dev_comm_.MergeFrom(from.l2_dev_comm_);
-  enter_l2_ipv4_addr_src_.MergeFrom(from.enter_l2_ipv4_addr_src_);
-  enter_arp_table_.MergeFrom(from.enter_arp_table_);
+  _this->_impl_.enter_l2devices_.MergeFrom(from._impl_.enter_l2devices_);
+  _this->_impl_.l2_dev_comm_.MergeFrom(from._impl_.l2_dev_comm_);
+  _this->_impl_.enter_l2_ipv4_addr_src_.MergeFrom(from._impl_.enter_l2_ipv4_addr_src_);
+  _this->_impl_.enter_arp_table_.MergeFrom(from._impl_.enter_arp_table_);
+  _this->_impl_.enter_l2device_ids_.MergeFrom(from._impl_.enter_l2device_ids_);
+  if (!from._internal_sensor().empty()) {
+    _this->_internal_set_sensor(from._internal_sensor());
+  }
+  if (from._internal_has_l2_columns()) {
+    _this->_internal_mutable_l2_columns()->::epoch::L2Columns::MergeFrom(
+        from._internal_l2_columns());
+  }
+  if (from._internal_encoding() != 0) {
+    _this->_internal_set_encoding(from._internal_encoding());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
 void EpochStep::CopyFrom(const EpochStep& from) {
@@ -1475,11 +2460,24 @@ bool EpochStep::IsInitialized() const {
 
 void EpochStep::InternalSwap(EpochStep* other) {
   using std::swap;
-  _internal_metadata_.Swap<std::string>(&other->_internal_metadata_);
-  enter_l2devices_.InternalSwap(&other->enter_l2devices_);
-  l2_dev_comm_.InternalSwap(&other->l2_dev_comm_);
-  enter_l2_ipv4_addr_src_.InternalSwap(&other->enter_l2_ipv4_addr_src_);
-  enter_arp_table_.InternalSwap(&other->enter_arp_table_);
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.enter_l2devices_.InternalSwap(&other->_impl_.enter_l2devices_);
+  _impl_.l2_dev_comm_.InternalSwap(&other->_impl_.l2_dev_comm_);
+  _impl_.enter_l2_ipv4_addr_src_.InternalSwap(&other->_impl_.enter_l2_ipv4_addr_src_);
+  _impl_.enter_arp_table_.InternalSwap(&other->_impl_.enter_arp_table_);
+  _impl_.enter_l2device_ids_.InternalSwap(&other->_impl_.enter_l2device_ids_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.sensor_, lhs_arena,
+      &other->_impl_.sensor_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(EpochStep, _impl_.encoding_)
+      + sizeof(EpochStep::_impl_.encoding_)
+      - PROTOBUF_FIELD_OFFSET(EpochStep, _impl_.l2_columns_)>(
+          reinterpret_cast<char*>(&_impl_.l2_columns_),
+          reinterpret_cast<char*>(&other->_impl_.l2_columns_));
 }
 
 std::string EpochStep::GetTypeName() const {
@@ -1490,19 +2488,28 @@ std::string EpochStep::GetTypeName() const {
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace epoch
 PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::epoch::L2Summary* Arena::CreateMaybeMessage< ::epoch::L2Summary >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::epoch::L2Summary*
+Arena::CreateMaybeMessage< ::epoch::L2Summary >(Arena* arena) {
   return Arena::CreateMessageInternal< ::epoch::L2Summary >(arena);
 }
-template<> PROTOBUF_NOINLINE ::epoch::DeviceComm* Arena::CreateMaybeMessage< ::epoch::DeviceComm >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::epoch::DeviceComm*
+Arena::CreateMaybeMessage< ::epoch::DeviceComm >(Arena* arena) {
   return Arena::CreateMessageInternal< ::epoch::DeviceComm >(arena);
 }
-template<> PROTOBUF_NOINLINE ::epoch::AddrAssoc* Arena::CreateMaybeMessage< ::epoch::AddrAssoc >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::epoch::AddrAssoc*
+Arena::CreateMaybeMessage< ::epoch::AddrAssoc >(Arena* arena) {
   return Arena::CreateMessageInternal< ::epoch::AddrAssoc >(arena);
 }
-template<> PROTOBUF_NOINLINE ::epoch::ArpAssoc* Arena::CreateMaybeMessage< ::epoch::ArpAssoc >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::epoch::ArpAssoc*
+Arena::CreateMaybeMessage< ::epoch::ArpAssoc >(Arena* arena) {
   return Arena::CreateMessageInternal< ::epoch::ArpAssoc >(arena);
 }
-template<> PROTOBUF_NOINLINE ::epoch::EpochStep* Arena::CreateMaybeMessage< ::epoch::EpochStep >(Arena* arena) {
+template<> PROTOBUF_NOINLINE ::epoch::L2Columns*
+Arena::CreateMaybeMessage< ::epoch::L2Columns >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::epoch::L2Columns >(arena);
+}
+template<> PROTOBUF_NOINLINE ::epoch::EpochStep*
+Arena::CreateMaybeMessage< ::epoch::EpochStep >(Arena* arena) {
   return Arena::CreateMessageInternal< ::epoch::EpochStep >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
@@ -8,12 +8,12 @@
 #include <string>
 
 #include <google/protobuf/port_def.inc>
-#if PROTOBUF_VERSION < 3012000
+#if PROTOBUF_VERSION < 3021000
 #error This file was generated by a newer version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please update
 #error your headers.
 #endif
-#if 3012000 < PROTOBUF_MIN_PROTOC_VERSION
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
 #error This file was generated by an older version of protoc which is
 #error incompatible with your Protocol Buffer headers. Please
 #error regenerate this file with a newer version of protoc.
@@ -23,13 +23,12 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/arena.h>
 #include <google/protobuf/arenastring.h>
-#include <google/protobuf/generated_message_table_driven.h>
 #include <google/protobuf/generated_message_util.h>
-#include <google/protobuf/inlined_string_field.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/message_lite.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_util.h>
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
 #define PROTOBUF_INTERNAL_EXPORT_epoch_2eproto
@@ -41,31 +40,26 @@ PROTOBUF_NAMESPACE_CLOSE
 
 // Internal implementation detail -- do not use these members.
 struct TableStruct_epoch_2eproto {
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTableField entries[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[5]
-    PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
-  static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
-  static const ::PROTOBUF_NAMESPACE_ID::uint32 offsets[];
+  static const uint32_t offsets[];
 };
 namespace epoch {
 class AddrAssoc;
-class AddrAssocDefaultTypeInternal;
+struct AddrAssocDefaultTypeInternal;
 extern AddrAssocDefaultTypeInternal _AddrAssoc_default_instance_;
 class ArpAssoc;
-class ArpAssocDefaultTypeInternal;
+struct ArpAssocDefaultTypeInternal;
 extern ArpAssocDefaultTypeInternal _ArpAssoc_default_instance_;
 class DeviceComm;
-class DeviceCommDefaultTypeInternal;
+struct DeviceCommDefaultTypeInternal;
 extern DeviceCommDefaultTypeInternal _DeviceComm_default_instance_;
 class EpochStep;
-class EpochStepDefaultTypeInternal;
+struct EpochStepDefaultTypeInternal;
 extern EpochStepDefaultTypeInternal _EpochStep_default_instance_;
+class L2Columns;
+struct L2ColumnsDefaultTypeInternal;
+extern L2ColumnsDefaultTypeInternal _L2Columns_default_instance_;
 class L2Summary;
-class L2SummaryDefaultTypeInternal;
+struct L2SummaryDefaultTypeInternal;
 extern L2SummaryDefaultTypeInternal _L2Summary_default_instance_;
 }  // namespace epoch
 PROTOBUF_NAMESPACE_OPEN
@@ -73,17 +67,41 @@ template<> ::epoch::AddrAssoc* Arena::CreateMaybeMessage<::epoch::AddrAssoc>(Are
 template<> ::epoch::ArpAssoc* Arena::CreateMaybeMessage<::epoch::ArpAssoc>(Arena*);
 template<> ::epoch::DeviceComm* Arena::CreateMaybeMessage<::epoch::DeviceComm>(Arena*);
 template<> ::epoch::EpochStep* Arena::CreateMaybeMessage<::epoch::EpochStep>(Arena*);
+template<> ::epoch::L2Columns* Arena::CreateMaybeMessage<::epoch::L2Columns>(Arena*);
 template<> ::epoch::L2Summary* Arena::CreateMaybeMessage<::epoch::L2Summary>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace epoch {
 
+enum RateEncoding : int {
+  FULL = 0,
+  KEYFRAME = 1,
+  DELTA = 2,
+  RateEncoding_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  RateEncoding_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool RateEncoding_IsValid(int value);
+constexpr RateEncoding RateEncoding_MIN = FULL;
+constexpr RateEncoding RateEncoding_MAX = DELTA;
+constexpr int RateEncoding_ARRAYSIZE = RateEncoding_MAX + 1;
+
+const std::string& RateEncoding_Name(RateEncoding value);
+template<typename T>
+inline const std::string& RateEncoding_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RateEncoding>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RateEncoding_Name.");
+  return RateEncoding_Name(static_cast<RateEncoding>(enum_t_value));
+}
+bool RateEncoding_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RateEncoding* value);
 // ===================================================================
 
-class L2Summary PROTOBUF_FINAL :
+class L2Summary final :
     public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:epoch.L2Summary) */ {
  public:
-  inline L2Summary() : L2Summary(nullptr) {};
-  virtual ~L2Summary();
+  inline L2Summary() : L2Summary(nullptr) {}
+  ~L2Summary() override;
+  explicit PROTOBUF_CONSTEXPR L2Summary(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   L2Summary(const L2Summary& from);
   L2Summary(L2Summary&& from) noexcept
@@ -96,17 +114,22 @@ class L2Summary PROTOBUF_FINAL :
     return *this;
   }
   inline L2Summary& operator=(L2Summary&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
 
-  static const L2Summary& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const L2Summary& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const L2Summary* internal_default_instance() {
     return reinterpret_cast<const L2Summary*>(
                &_L2Summary_default_instance_);
@@ -119,7 +142,12 @@ class L2Summary PROTOBUF_FINAL :
   }
   inline void Swap(L2Summary* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -127,21 +155,16 @@ class L2Summary PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(L2Summary* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline L2Summary* New() const final {
-    return CreateMaybeMessage<L2Summary>(nullptr);
-  }
-
-  L2Summary* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  L2Summary* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<L2Summary>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const L2Summary& from);
   void MergeFrom(const L2Summary& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
@@ -149,25 +172,24 @@ class L2Summary PROTOBUF_FINAL :
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(L2Summary* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "epoch.L2Summary";
   }
   protected:
-  explicit L2Summary(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit L2Summary(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
   std::string GetTypeName() const final;
@@ -182,50 +204,60 @@ class L2Summary PROTOBUF_FINAL :
     kIpv6FieldNumber = 3,
     kArpFieldNumber = 4,
     kUnknownFieldNumber = 5,
+    kDstIdFieldNumber = 6,
   };
   // fixed64 mac_dst = 1;
   void clear_mac_dst();
-  ::PROTOBUF_NAMESPACE_ID::uint64 mac_dst() const;
-  void set_mac_dst(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t mac_dst() const;
+  void set_mac_dst(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_mac_dst() const;
-  void _internal_set_mac_dst(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t _internal_mac_dst() const;
+  void _internal_set_mac_dst(uint64_t value);
   public:
 
   // uint32 ipv4 = 2;
   void clear_ipv4();
-  ::PROTOBUF_NAMESPACE_ID::uint32 ipv4() const;
-  void set_ipv4(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t ipv4() const;
+  void set_ipv4(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_ipv4() const;
-  void _internal_set_ipv4(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_ipv4() const;
+  void _internal_set_ipv4(uint32_t value);
   public:
 
   // uint32 ipv6 = 3;
   void clear_ipv6();
-  ::PROTOBUF_NAMESPACE_ID::uint32 ipv6() const;
-  void set_ipv6(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t ipv6() const;
+  void set_ipv6(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_ipv6() const;
-  void _internal_set_ipv6(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_ipv6() const;
+  void _internal_set_ipv6(uint32_t value);
   public:
 
   // uint32 arp = 4;
   void clear_arp();
-  ::PROTOBUF_NAMESPACE_ID::uint32 arp() const;
-  void set_arp(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t arp() const;
+  void set_arp(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_arp() const;
-  void _internal_set_arp(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_arp() const;
+  void _internal_set_arp(uint32_t value);
   public:
 
   // uint32 unknown = 5;
   void clear_unknown();
-  ::PROTOBUF_NAMESPACE_ID::uint32 unknown() const;
-  void set_unknown(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t unknown() const;
+  void set_unknown(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_unknown() const;
-  void _internal_set_unknown(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_unknown() const;
+  void _internal_set_unknown(uint32_t value);
+  public:
+
+  // uint32 dst_id = 6;
+  void clear_dst_id();
+  uint32_t dst_id() const;
+  void set_dst_id(uint32_t value);
+  private:
+  uint32_t _internal_dst_id() const;
+  void _internal_set_dst_id(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:epoch.L2Summary)
@@ -235,21 +267,26 @@ class L2Summary PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 mac_dst_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 ipv4_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 ipv6_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 arp_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 unknown_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    uint64_t mac_dst_;
+    uint32_t ipv4_;
+    uint32_t ipv6_;
+    uint32_t arp_;
+    uint32_t unknown_;
+    uint32_t dst_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_epoch_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DeviceComm PROTOBUF_FINAL :
+class DeviceComm final :
     public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:epoch.DeviceComm) */ {
  public:
-  inline DeviceComm() : DeviceComm(nullptr) {};
-  virtual ~DeviceComm();
+  inline DeviceComm() : DeviceComm(nullptr) {}
+  ~DeviceComm() override;
+  explicit PROTOBUF_CONSTEXPR DeviceComm(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   DeviceComm(const DeviceComm& from);
   DeviceComm(DeviceComm&& from) noexcept
@@ -262,17 +299,22 @@ class DeviceComm PROTOBUF_FINAL :
     return *this;
   }
   inline DeviceComm& operator=(DeviceComm&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
 
-  static const DeviceComm& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const DeviceComm& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const DeviceComm* internal_default_instance() {
     return reinterpret_cast<const DeviceComm*>(
                &_DeviceComm_default_instance_);
@@ -285,7 +327,12 @@ class DeviceComm PROTOBUF_FINAL :
   }
   inline void Swap(DeviceComm* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -293,21 +340,16 @@ class DeviceComm PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(DeviceComm* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline DeviceComm* New() const final {
-    return CreateMaybeMessage<DeviceComm>(nullptr);
-  }
-
-  DeviceComm* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  DeviceComm* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<DeviceComm>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const DeviceComm& from);
   void MergeFrom(const DeviceComm& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
@@ -315,25 +357,24 @@ class DeviceComm PROTOBUF_FINAL :
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(DeviceComm* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "epoch.DeviceComm";
   }
   protected:
-  explicit DeviceComm(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit DeviceComm(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
   std::string GetTypeName() const final;
@@ -347,8 +388,9 @@ class DeviceComm PROTOBUF_FINAL :
     kBcast33FieldNumber = 3,
     kBcastFfFieldNumber = 4,
     kBcast01FieldNumber = 5,
-    kBcastXXFieldNumber = 6,
+    kBcastXxFieldNumber = 6,
     kMacSrcFieldNumber = 1,
+    kSrcIdFieldNumber = 7,
   };
   // repeated .epoch.L2Summary tx_summary = 2;
   int tx_summary_size() const;
@@ -375,7 +417,7 @@ class DeviceComm PROTOBUF_FINAL :
   public:
   void clear_bcast_33();
   const ::epoch::L2Summary& bcast_33() const;
-  ::epoch::L2Summary* release_bcast_33();
+  PROTOBUF_NODISCARD ::epoch::L2Summary* release_bcast_33();
   ::epoch::L2Summary* mutable_bcast_33();
   void set_allocated_bcast_33(::epoch::L2Summary* bcast_33);
   private:
@@ -393,7 +435,7 @@ class DeviceComm PROTOBUF_FINAL :
   public:
   void clear_bcast_ff();
   const ::epoch::L2Summary& bcast_ff() const;
-  ::epoch::L2Summary* release_bcast_ff();
+  PROTOBUF_NODISCARD ::epoch::L2Summary* release_bcast_ff();
   ::epoch::L2Summary* mutable_bcast_ff();
   void set_allocated_bcast_ff(::epoch::L2Summary* bcast_ff);
   private:
@@ -411,7 +453,7 @@ class DeviceComm PROTOBUF_FINAL :
   public:
   void clear_bcast_01();
   const ::epoch::L2Summary& bcast_01() const;
-  ::epoch::L2Summary* release_bcast_01();
+  PROTOBUF_NODISCARD ::epoch::L2Summary* release_bcast_01();
   ::epoch::L2Summary* mutable_bcast_01();
   void set_allocated_bcast_01(::epoch::L2Summary* bcast_01);
   private:
@@ -422,14 +464,14 @@ class DeviceComm PROTOBUF_FINAL :
       ::epoch::L2Summary* bcast_01);
   ::epoch::L2Summary* unsafe_arena_release_bcast_01();
 
-  // .epoch.L2Summary bcast_XX = 6;
+  // .epoch.L2Summary bcast_xx = 6;
   bool has_bcast_xx() const;
   private:
   bool _internal_has_bcast_xx() const;
   public:
   void clear_bcast_xx();
   const ::epoch::L2Summary& bcast_xx() const;
-  ::epoch::L2Summary* release_bcast_xx();
+  PROTOBUF_NODISCARD ::epoch::L2Summary* release_bcast_xx();
   ::epoch::L2Summary* mutable_bcast_xx();
   void set_allocated_bcast_xx(::epoch::L2Summary* bcast_xx);
   private:
@@ -442,11 +484,20 @@ class DeviceComm PROTOBUF_FINAL :
 
   // fixed64 mac_src = 1;
   void clear_mac_src();
-  ::PROTOBUF_NAMESPACE_ID::uint64 mac_src() const;
-  void set_mac_src(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t mac_src() const;
+  void set_mac_src(uint64_t value);
+  private:
+  uint64_t _internal_mac_src() const;
+  void _internal_set_mac_src(uint64_t value);
+  public:
+
+  // uint32 src_id = 7;
+  void clear_src_id();
+  uint32_t src_id() const;
+  void set_src_id(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_mac_src() const;
-  void _internal_set_mac_src(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint32_t _internal_src_id() const;
+  void _internal_set_src_id(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:epoch.DeviceComm)
@@ -456,22 +507,27 @@ class DeviceComm PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::epoch::L2Summary > tx_summary_;
-  ::epoch::L2Summary* bcast_33_;
-  ::epoch::L2Summary* bcast_ff_;
-  ::epoch::L2Summary* bcast_01_;
-  ::epoch::L2Summary* bcast_xx_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 mac_src_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::epoch::L2Summary > tx_summary_;
+    ::epoch::L2Summary* bcast_33_;
+    ::epoch::L2Summary* bcast_ff_;
+    ::epoch::L2Summary* bcast_01_;
+    ::epoch::L2Summary* bcast_xx_;
+    uint64_t mac_src_;
+    uint32_t src_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_epoch_2eproto;
 };
 // -------------------------------------------------------------------
 
-class AddrAssoc PROTOBUF_FINAL :
+class AddrAssoc final :
     public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:epoch.AddrAssoc) */ {
  public:
-  inline AddrAssoc() : AddrAssoc(nullptr) {};
-  virtual ~AddrAssoc();
+  inline AddrAssoc() : AddrAssoc(nullptr) {}
+  ~AddrAssoc() override;
+  explicit PROTOBUF_CONSTEXPR AddrAssoc(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   AddrAssoc(const AddrAssoc& from);
   AddrAssoc(AddrAssoc&& from) noexcept
@@ -484,17 +540,22 @@ class AddrAssoc PROTOBUF_FINAL :
     return *this;
   }
   inline AddrAssoc& operator=(AddrAssoc&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
 
-  static const AddrAssoc& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const AddrAssoc& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const AddrAssoc* internal_default_instance() {
     return reinterpret_cast<const AddrAssoc*>(
                &_AddrAssoc_default_instance_);
@@ -507,7 +568,12 @@ class AddrAssoc PROTOBUF_FINAL :
   }
   inline void Swap(AddrAssoc* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -515,21 +581,16 @@ class AddrAssoc PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(AddrAssoc* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline AddrAssoc* New() const final {
-    return CreateMaybeMessage<AddrAssoc>(nullptr);
-  }
-
-  AddrAssoc* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  AddrAssoc* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<AddrAssoc>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const AddrAssoc& from);
   void MergeFrom(const AddrAssoc& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
@@ -537,25 +598,24 @@ class AddrAssoc PROTOBUF_FINAL :
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(AddrAssoc* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "epoch.AddrAssoc";
   }
   protected:
-  explicit AddrAssoc(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit AddrAssoc(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
   std::string GetTypeName() const final;
@@ -567,23 +627,33 @@ class AddrAssoc PROTOBUF_FINAL :
   enum : int {
     kMacSrcFieldNumber = 1,
     kIpv4FieldNumber = 2,
+    kIdFieldNumber = 3,
   };
   // fixed64 mac_src = 1;
   void clear_mac_src();
-  ::PROTOBUF_NAMESPACE_ID::uint64 mac_src() const;
-  void set_mac_src(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t mac_src() const;
+  void set_mac_src(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_mac_src() const;
-  void _internal_set_mac_src(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t _internal_mac_src() const;
+  void _internal_set_mac_src(uint64_t value);
   public:
 
   // fixed32 ipv4 = 2;
   void clear_ipv4();
-  ::PROTOBUF_NAMESPACE_ID::uint32 ipv4() const;
-  void set_ipv4(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t ipv4() const;
+  void set_ipv4(uint32_t value);
+  private:
+  uint32_t _internal_ipv4() const;
+  void _internal_set_ipv4(uint32_t value);
+  public:
+
+  // uint32 id = 3;
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint32 _internal_ipv4() const;
-  void _internal_set_ipv4(::PROTOBUF_NAMESPACE_ID::uint32 value);
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:epoch.AddrAssoc)
@@ -593,18 +663,23 @@ class AddrAssoc PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 mac_src_;
-  ::PROTOBUF_NAMESPACE_ID::uint32 ipv4_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    uint64_t mac_src_;
+    uint32_t ipv4_;
+    uint32_t id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_epoch_2eproto;
 };
 // -------------------------------------------------------------------
 
-class ArpAssoc PROTOBUF_FINAL :
+class ArpAssoc final :
     public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:epoch.ArpAssoc) */ {
  public:
-  inline ArpAssoc() : ArpAssoc(nullptr) {};
-  virtual ~ArpAssoc();
+  inline ArpAssoc() : ArpAssoc(nullptr) {}
+  ~ArpAssoc() override;
+  explicit PROTOBUF_CONSTEXPR ArpAssoc(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   ArpAssoc(const ArpAssoc& from);
   ArpAssoc(ArpAssoc&& from) noexcept
@@ -617,17 +692,22 @@ class ArpAssoc PROTOBUF_FINAL :
     return *this;
   }
   inline ArpAssoc& operator=(ArpAssoc&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
 
-  static const ArpAssoc& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const ArpAssoc& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const ArpAssoc* internal_default_instance() {
     return reinterpret_cast<const ArpAssoc*>(
                &_ArpAssoc_default_instance_);
@@ -640,7 +720,12 @@ class ArpAssoc PROTOBUF_FINAL :
   }
   inline void Swap(ArpAssoc* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -648,21 +733,16 @@ class ArpAssoc PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(ArpAssoc* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline ArpAssoc* New() const final {
-    return CreateMaybeMessage<ArpAssoc>(nullptr);
-  }
-
-  ArpAssoc* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  ArpAssoc* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<ArpAssoc>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const ArpAssoc& from);
   void MergeFrom(const ArpAssoc& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
@@ -670,25 +750,24 @@ class ArpAssoc PROTOBUF_FINAL :
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(ArpAssoc* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "epoch.ArpAssoc";
   }
   protected:
-  explicit ArpAssoc(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit ArpAssoc(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
   std::string GetTypeName() const final;
@@ -721,11 +800,11 @@ class ArpAssoc PROTOBUF_FINAL :
 
   // fixed64 mac_src = 1;
   void clear_mac_src();
-  ::PROTOBUF_NAMESPACE_ID::uint64 mac_src() const;
-  void set_mac_src(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t mac_src() const;
+  void set_mac_src(uint64_t value);
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_mac_src() const;
-  void _internal_set_mac_src(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  uint64_t _internal_mac_src() const;
+  void _internal_set_mac_src(uint64_t value);
   public:
 
   // @@protoc_insertion_point(class_scope:epoch.ArpAssoc)
@@ -735,18 +814,441 @@ class ArpAssoc PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::epoch::AddrAssoc > table_row_;
-  ::PROTOBUF_NAMESPACE_ID::uint64 mac_src_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::epoch::AddrAssoc > table_row_;
+    uint64_t mac_src_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_epoch_2eproto;
 };
 // -------------------------------------------------------------------
 
-class EpochStep PROTOBUF_FINAL :
+class L2Columns final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:epoch.L2Columns) */ {
+ public:
+  inline L2Columns() : L2Columns(nullptr) {}
+  ~L2Columns() override;
+  explicit PROTOBUF_CONSTEXPR L2Columns(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  L2Columns(const L2Columns& from);
+  L2Columns(L2Columns&& from) noexcept
+    : L2Columns() {
+    *this = ::std::move(from);
+  }
+
+  inline L2Columns& operator=(const L2Columns& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline L2Columns& operator=(L2Columns&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const L2Columns& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const L2Columns* internal_default_instance() {
+    return reinterpret_cast<const L2Columns*>(
+               &_L2Columns_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(L2Columns& a, L2Columns& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(L2Columns* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(L2Columns* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  L2Columns* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<L2Columns>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const L2Columns& from);
+  void MergeFrom(const L2Columns& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(L2Columns* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "epoch.L2Columns";
+  }
+  protected:
+  explicit L2Columns(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSrcIdFieldNumber = 1,
+    kDstIdFieldNumber = 2,
+    kIpv4FieldNumber = 3,
+    kIpv6FieldNumber = 4,
+    kArpFieldNumber = 5,
+    kUnknownFieldNumber = 6,
+    kBcastSrcIdFieldNumber = 7,
+    kBcastPoolFieldNumber = 8,
+    kBcastIpv4FieldNumber = 9,
+    kBcastIpv6FieldNumber = 10,
+    kBcastArpFieldNumber = 11,
+    kBcastUnknownFieldNumber = 12,
+  };
+  // repeated uint32 src_id = 1;
+  int src_id_size() const;
+  private:
+  int _internal_src_id_size() const;
+  public:
+  void clear_src_id();
+  private:
+  uint32_t _internal_src_id(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_src_id() const;
+  void _internal_add_src_id(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_src_id();
+  public:
+  uint32_t src_id(int index) const;
+  void set_src_id(int index, uint32_t value);
+  void add_src_id(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      src_id() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_src_id();
+
+  // repeated uint32 dst_id = 2;
+  int dst_id_size() const;
+  private:
+  int _internal_dst_id_size() const;
+  public:
+  void clear_dst_id();
+  private:
+  uint32_t _internal_dst_id(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_dst_id() const;
+  void _internal_add_dst_id(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_dst_id();
+  public:
+  uint32_t dst_id(int index) const;
+  void set_dst_id(int index, uint32_t value);
+  void add_dst_id(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      dst_id() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_dst_id();
+
+  // repeated uint32 ipv4 = 3;
+  int ipv4_size() const;
+  private:
+  int _internal_ipv4_size() const;
+  public:
+  void clear_ipv4();
+  private:
+  uint32_t _internal_ipv4(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_ipv4() const;
+  void _internal_add_ipv4(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_ipv4();
+  public:
+  uint32_t ipv4(int index) const;
+  void set_ipv4(int index, uint32_t value);
+  void add_ipv4(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      ipv4() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_ipv4();
+
+  // repeated uint32 ipv6 = 4;
+  int ipv6_size() const;
+  private:
+  int _internal_ipv6_size() const;
+  public:
+  void clear_ipv6();
+  private:
+  uint32_t _internal_ipv6(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_ipv6() const;
+  void _internal_add_ipv6(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_ipv6();
+  public:
+  uint32_t ipv6(int index) const;
+  void set_ipv6(int index, uint32_t value);
+  void add_ipv6(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      ipv6() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_ipv6();
+
+  // repeated uint32 arp = 5;
+  int arp_size() const;
+  private:
+  int _internal_arp_size() const;
+  public:
+  void clear_arp();
+  private:
+  uint32_t _internal_arp(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_arp() const;
+  void _internal_add_arp(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_arp();
+  public:
+  uint32_t arp(int index) const;
+  void set_arp(int index, uint32_t value);
+  void add_arp(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      arp() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_arp();
+
+  // repeated uint32 unknown = 6;
+  int unknown_size() const;
+  private:
+  int _internal_unknown_size() const;
+  public:
+  void clear_unknown();
+  private:
+  uint32_t _internal_unknown(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_unknown() const;
+  void _internal_add_unknown(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_unknown();
+  public:
+  uint32_t unknown(int index) const;
+  void set_unknown(int index, uint32_t value);
+  void add_unknown(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      unknown() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_unknown();
+
+  // repeated uint32 bcast_src_id = 7;
+  int bcast_src_id_size() const;
+  private:
+  int _internal_bcast_src_id_size() const;
+  public:
+  void clear_bcast_src_id();
+  private:
+  uint32_t _internal_bcast_src_id(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_bcast_src_id() const;
+  void _internal_add_bcast_src_id(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_bcast_src_id();
+  public:
+  uint32_t bcast_src_id(int index) const;
+  void set_bcast_src_id(int index, uint32_t value);
+  void add_bcast_src_id(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      bcast_src_id() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_bcast_src_id();
+
+  // repeated uint32 bcast_pool = 8;
+  int bcast_pool_size() const;
+  private:
+  int _internal_bcast_pool_size() const;
+  public:
+  void clear_bcast_pool();
+  private:
+  uint32_t _internal_bcast_pool(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_bcast_pool() const;
+  void _internal_add_bcast_pool(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_bcast_pool();
+  public:
+  uint32_t bcast_pool(int index) const;
+  void set_bcast_pool(int index, uint32_t value);
+  void add_bcast_pool(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      bcast_pool() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_bcast_pool();
+
+  // repeated uint32 bcast_ipv4 = 9;
+  int bcast_ipv4_size() const;
+  private:
+  int _internal_bcast_ipv4_size() const;
+  public:
+  void clear_bcast_ipv4();
+  private:
+  uint32_t _internal_bcast_ipv4(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_bcast_ipv4() const;
+  void _internal_add_bcast_ipv4(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_bcast_ipv4();
+  public:
+  uint32_t bcast_ipv4(int index) const;
+  void set_bcast_ipv4(int index, uint32_t value);
+  void add_bcast_ipv4(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      bcast_ipv4() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_bcast_ipv4();
+
+  // repeated uint32 bcast_ipv6 = 10;
+  int bcast_ipv6_size() const;
+  private:
+  int _internal_bcast_ipv6_size() const;
+  public:
+  void clear_bcast_ipv6();
+  private:
+  uint32_t _internal_bcast_ipv6(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_bcast_ipv6() const;
+  void _internal_add_bcast_ipv6(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_bcast_ipv6();
+  public:
+  uint32_t bcast_ipv6(int index) const;
+  void set_bcast_ipv6(int index, uint32_t value);
+  void add_bcast_ipv6(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      bcast_ipv6() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_bcast_ipv6();
+
+  // repeated uint32 bcast_arp = 11;
+  int bcast_arp_size() const;
+  private:
+  int _internal_bcast_arp_size() const;
+  public:
+  void clear_bcast_arp();
+  private:
+  uint32_t _internal_bcast_arp(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_bcast_arp() const;
+  void _internal_add_bcast_arp(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_bcast_arp();
+  public:
+  uint32_t bcast_arp(int index) const;
+  void set_bcast_arp(int index, uint32_t value);
+  void add_bcast_arp(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      bcast_arp() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_bcast_arp();
+
+  // repeated uint32 bcast_unknown = 12;
+  int bcast_unknown_size() const;
+  private:
+  int _internal_bcast_unknown_size() const;
+  public:
+  void clear_bcast_unknown();
+  private:
+  uint32_t _internal_bcast_unknown(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_bcast_unknown() const;
+  void _internal_add_bcast_unknown(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_bcast_unknown();
+  public:
+  uint32_t bcast_unknown(int index) const;
+  void set_bcast_unknown(int index, uint32_t value);
+  void add_bcast_unknown(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      bcast_unknown() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_bcast_unknown();
+
+  // @@protoc_insertion_point(class_scope:epoch.L2Columns)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > src_id_;
+    mutable std::atomic<int> _src_id_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > dst_id_;
+    mutable std::atomic<int> _dst_id_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > ipv4_;
+    mutable std::atomic<int> _ipv4_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > ipv6_;
+    mutable std::atomic<int> _ipv6_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > arp_;
+    mutable std::atomic<int> _arp_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > unknown_;
+    mutable std::atomic<int> _unknown_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > bcast_src_id_;
+    mutable std::atomic<int> _bcast_src_id_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > bcast_pool_;
+    mutable std::atomic<int> _bcast_pool_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > bcast_ipv4_;
+    mutable std::atomic<int> _bcast_ipv4_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > bcast_ipv6_;
+    mutable std::atomic<int> _bcast_ipv6_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > bcast_arp_;
+    mutable std::atomic<int> _bcast_arp_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > bcast_unknown_;
+    mutable std::atomic<int> _bcast_unknown_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_epoch_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EpochStep final :
     public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:epoch.EpochStep) */ {
  public:
-  inline EpochStep() : EpochStep(nullptr) {};
-  virtual ~EpochStep();
+  inline EpochStep() : EpochStep(nullptr) {}
+  ~EpochStep() override;
+  explicit PROTOBUF_CONSTEXPR EpochStep(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
   EpochStep(const EpochStep& from);
   EpochStep(EpochStep&& from) noexcept
@@ -759,30 +1261,40 @@ class EpochStep PROTOBUF_FINAL :
     return *this;
   }
   inline EpochStep& operator=(EpochStep&& from) noexcept {
-    if (GetArena() == from.GetArena()) {
-      if (this != &from) InternalSwap(&from);
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
     } else {
       CopyFrom(from);
     }
     return *this;
   }
 
-  static const EpochStep& default_instance();
-
-  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static const EpochStep& default_instance() {
+    return *internal_default_instance();
+  }
   static inline const EpochStep* internal_default_instance() {
     return reinterpret_cast<const EpochStep*>(
                &_EpochStep_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    5;
 
   friend void swap(EpochStep& a, EpochStep& b) {
     a.Swap(&b);
   }
   inline void Swap(EpochStep* other) {
     if (other == this) return;
-    if (GetArena() == other->GetArena()) {
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
       InternalSwap(other);
     } else {
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
@@ -790,21 +1302,16 @@ class EpochStep PROTOBUF_FINAL :
   }
   void UnsafeArenaSwap(EpochStep* other) {
     if (other == this) return;
-    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
   }
 
   // implements Message ----------------------------------------------
 
-  inline EpochStep* New() const final {
-    return CreateMaybeMessage<EpochStep>(nullptr);
-  }
-
-  EpochStep* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+  EpochStep* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
     return CreateMaybeMessage<EpochStep>(arena);
   }
-  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)
-    final;
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
   void CopyFrom(const EpochStep& from);
   void MergeFrom(const EpochStep& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
@@ -812,25 +1319,24 @@ class EpochStep PROTOBUF_FINAL :
 
   size_t ByteSizeLong() const final;
   const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
-      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  void DiscardUnknownFields();
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
 
   private:
-  inline void SharedCtor();
-  inline void SharedDtor();
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
   void SetCachedSize(int size) const;
   void InternalSwap(EpochStep* other);
+
+  private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
     return "epoch.EpochStep";
   }
   protected:
-  explicit EpochStep(::PROTOBUF_NAMESPACE_ID::Arena* arena);
-  private:
-  static void ArenaDtor(void* object);
-  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  explicit EpochStep(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
   std::string GetTypeName() const final;
@@ -844,6 +1350,10 @@ class EpochStep PROTOBUF_FINAL :
     kL2DevCommFieldNumber = 2,
     kEnterL2Ipv4AddrSrcFieldNumber = 3,
     kEnterArpTableFieldNumber = 4,
+    kEnterL2DeviceIdsFieldNumber = 7,
+    kSensorFieldNumber = 5,
+    kL2ColumnsFieldNumber = 8,
+    kEncodingFieldNumber = 6,
   };
   // repeated fixed64 enter_l2devices = 1;
   int enter_l2devices_size() const;
@@ -852,19 +1362,19 @@ class EpochStep PROTOBUF_FINAL :
   public:
   void clear_enter_l2devices();
   private:
-  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_enter_l2devices(int index) const;
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+  uint64_t _internal_enter_l2devices(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
       _internal_enter_l2devices() const;
-  void _internal_add_enter_l2devices(::PROTOBUF_NAMESPACE_ID::uint64 value);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+  void _internal_add_enter_l2devices(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
       _internal_mutable_enter_l2devices();
   public:
-  ::PROTOBUF_NAMESPACE_ID::uint64 enter_l2devices(int index) const;
-  void set_enter_l2devices(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value);
-  void add_enter_l2devices(::PROTOBUF_NAMESPACE_ID::uint64 value);
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+  uint64_t enter_l2devices(int index) const;
+  void set_enter_l2devices(int index, uint64_t value);
+  void add_enter_l2devices(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
       enter_l2devices() const;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
       mutable_enter_l2devices();
 
   // repeated .epoch.DeviceComm l2_dev_comm = 2;
@@ -921,6 +1431,69 @@ class EpochStep PROTOBUF_FINAL :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::epoch::ArpAssoc >&
       enter_arp_table() const;
 
+  // repeated uint32 enter_l2device_ids = 7;
+  int enter_l2device_ids_size() const;
+  private:
+  int _internal_enter_l2device_ids_size() const;
+  public:
+  void clear_enter_l2device_ids();
+  private:
+  uint32_t _internal_enter_l2device_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_enter_l2device_ids() const;
+  void _internal_add_enter_l2device_ids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_enter_l2device_ids();
+  public:
+  uint32_t enter_l2device_ids(int index) const;
+  void set_enter_l2device_ids(int index, uint32_t value);
+  void add_enter_l2device_ids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      enter_l2device_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_enter_l2device_ids();
+
+  // string sensor = 5;
+  void clear_sensor();
+  const std::string& sensor() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_sensor(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_sensor();
+  PROTOBUF_NODISCARD std::string* release_sensor();
+  void set_allocated_sensor(std::string* sensor);
+  private:
+  const std::string& _internal_sensor() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_sensor(const std::string& value);
+  std::string* _internal_mutable_sensor();
+  public:
+
+  // .epoch.L2Columns l2_columns = 8;
+  bool has_l2_columns() const;
+  private:
+  bool _internal_has_l2_columns() const;
+  public:
+  void clear_l2_columns();
+  const ::epoch::L2Columns& l2_columns() const;
+  PROTOBUF_NODISCARD ::epoch::L2Columns* release_l2_columns();
+  ::epoch::L2Columns* mutable_l2_columns();
+  void set_allocated_l2_columns(::epoch::L2Columns* l2_columns);
+  private:
+  const ::epoch::L2Columns& _internal_l2_columns() const;
+  ::epoch::L2Columns* _internal_mutable_l2_columns();
+  public:
+  void unsafe_arena_set_allocated_l2_columns(
+      ::epoch::L2Columns* l2_columns);
+  ::epoch::L2Columns* unsafe_arena_release_l2_columns();
+
+  // .epoch.RateEncoding encoding = 6;
+  void clear_encoding();
+  ::epoch::RateEncoding encoding() const;
+  void set_encoding(::epoch::RateEncoding value);
+  private:
+  ::epoch::RateEncoding _internal_encoding() const;
+  void _internal_set_encoding(::epoch::RateEncoding value);
+  public:
+
   // @@protoc_insertion_point(class_scope:epoch.EpochStep)
  private:
   class _Internal;
@@ -928,12 +1501,19 @@ class EpochStep PROTOBUF_FINAL :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 > enter_l2devices_;
-  mutable std::atomic<int> _enter_l2devices_cached_byte_size_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::epoch::DeviceComm > l2_dev_comm_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::epoch::AddrAssoc > enter_l2_ipv4_addr_src_;
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::epoch::ArpAssoc > enter_arp_table_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > enter_l2devices_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::epoch::DeviceComm > l2_dev_comm_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::epoch::AddrAssoc > enter_l2_ipv4_addr_src_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::epoch::ArpAssoc > enter_arp_table_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > enter_l2device_ids_;
+    mutable std::atomic<int> _enter_l2device_ids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sensor_;
+    ::epoch::L2Columns* l2_columns_;
+    int encoding_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
   friend struct ::TableStruct_epoch_2eproto;
 };
 // ===================================================================
@@ -949,184 +1529,205 @@ class EpochStep PROTOBUF_FINAL :
 
 // fixed64 mac_dst = 1;
 inline void L2Summary::clear_mac_dst() {
-  mac_dst_ = PROTOBUF_ULONGLONG(0);
+  _impl_.mac_dst_ = uint64_t{0u};
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 L2Summary::_internal_mac_dst() const {
-  return mac_dst_;
+inline uint64_t L2Summary::_internal_mac_dst() const {
+  return _impl_.mac_dst_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 L2Summary::mac_dst() const {
+inline uint64_t L2Summary::mac_dst() const {
   // @@protoc_insertion_point(field_get:epoch.L2Summary.mac_dst)
   return _internal_mac_dst();
 }
-inline void L2Summary::_internal_set_mac_dst(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void L2Summary::_internal_set_mac_dst(uint64_t value) {
   
-  mac_dst_ = value;
+  _impl_.mac_dst_ = value;
 }
-inline void L2Summary::set_mac_dst(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void L2Summary::set_mac_dst(uint64_t value) {
   _internal_set_mac_dst(value);
   // @@protoc_insertion_point(field_set:epoch.L2Summary.mac_dst)
 }
 
 // uint32 ipv4 = 2;
 inline void L2Summary::clear_ipv4() {
-  ipv4_ = 0u;
+  _impl_.ipv4_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 L2Summary::_internal_ipv4() const {
-  return ipv4_;
+inline uint32_t L2Summary::_internal_ipv4() const {
+  return _impl_.ipv4_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 L2Summary::ipv4() const {
+inline uint32_t L2Summary::ipv4() const {
   // @@protoc_insertion_point(field_get:epoch.L2Summary.ipv4)
   return _internal_ipv4();
 }
-inline void L2Summary::_internal_set_ipv4(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void L2Summary::_internal_set_ipv4(uint32_t value) {
   
-  ipv4_ = value;
+  _impl_.ipv4_ = value;
 }
-inline void L2Summary::set_ipv4(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void L2Summary::set_ipv4(uint32_t value) {
   _internal_set_ipv4(value);
   // @@protoc_insertion_point(field_set:epoch.L2Summary.ipv4)
 }
 
 // uint32 ipv6 = 3;
 inline void L2Summary::clear_ipv6() {
-  ipv6_ = 0u;
+  _impl_.ipv6_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 L2Summary::_internal_ipv6() const {
-  return ipv6_;
+inline uint32_t L2Summary::_internal_ipv6() const {
+  return _impl_.ipv6_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 L2Summary::ipv6() const {
+inline uint32_t L2Summary::ipv6() const {
   // @@protoc_insertion_point(field_get:epoch.L2Summary.ipv6)
   return _internal_ipv6();
 }
-inline void L2Summary::_internal_set_ipv6(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void L2Summary::_internal_set_ipv6(uint32_t value) {
   
-  ipv6_ = value;
+  _impl_.ipv6_ = value;
 }
-inline void L2Summary::set_ipv6(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void L2Summary::set_ipv6(uint32_t value) {
   _internal_set_ipv6(value);
   // @@protoc_insertion_point(field_set:epoch.L2Summary.ipv6)
 }
 
 // uint32 arp = 4;
 inline void L2Summary::clear_arp() {
-  arp_ = 0u;
+  _impl_.arp_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 L2Summary::_internal_arp() const {
-  return arp_;
+inline uint32_t L2Summary::_internal_arp() const {
+  return _impl_.arp_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 L2Summary::arp() const {
+inline uint32_t L2Summary::arp() const {
   // @@protoc_insertion_point(field_get:epoch.L2Summary.arp)
   return _internal_arp();
 }
-inline void L2Summary::_internal_set_arp(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void L2Summary::_internal_set_arp(uint32_t value) {
   
-  arp_ = value;
+  _impl_.arp_ = value;
 }
-inline void L2Summary::set_arp(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void L2Summary::set_arp(uint32_t value) {
   _internal_set_arp(value);
   // @@protoc_insertion_point(field_set:epoch.L2Summary.arp)
 }
 
 // uint32 unknown = 5;
 inline void L2Summary::clear_unknown() {
-  unknown_ = 0u;
+  _impl_.unknown_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 L2Summary::_internal_unknown() const {
-  return unknown_;
+inline uint32_t L2Summary::_internal_unknown() const {
+  return _impl_.unknown_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 L2Summary::unknown() const {
+inline uint32_t L2Summary::unknown() const {
   // @@protoc_insertion_point(field_get:epoch.L2Summary.unknown)
   return _internal_unknown();
 }
-inline void L2Summary::_internal_set_unknown(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void L2Summary::_internal_set_unknown(uint32_t value) {
   
-  unknown_ = value;
+  _impl_.unknown_ = value;
 }
-inline void L2Summary::set_unknown(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void L2Summary::set_unknown(uint32_t value) {
   _internal_set_unknown(value);
   // @@protoc_insertion_point(field_set:epoch.L2Summary.unknown)
 }
 
+// uint32 dst_id = 6;
+inline void L2Summary::clear_dst_id() {
+  _impl_.dst_id_ = 0u;
+}
+inline uint32_t L2Summary::_internal_dst_id() const {
+  return _impl_.dst_id_;
+}
+inline uint32_t L2Summary::dst_id() const {
+  // @@protoc_insertion_point(field_get:epoch.L2Summary.dst_id)
+  return _internal_dst_id();
+}
+inline void L2Summary::_internal_set_dst_id(uint32_t value) {
+  
+  _impl_.dst_id_ = value;
+}
+inline void L2Summary::set_dst_id(uint32_t value) {
+  _internal_set_dst_id(value);
+  // @@protoc_insertion_point(field_set:epoch.L2Summary.dst_id)
+}
+
 // -------------------------------------------------------------------
 
 // DeviceComm
 
 // fixed64 mac_src = 1;
 inline void DeviceComm::clear_mac_src() {
-  mac_src_ = PROTOBUF_ULONGLONG(0);
+  _impl_.mac_src_ = uint64_t{0u};
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 DeviceComm::_internal_mac_src() const {
-  return mac_src_;
+inline uint64_t DeviceComm::_internal_mac_src() const {
+  return _impl_.mac_src_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 DeviceComm::mac_src() const {
+inline uint64_t DeviceComm::mac_src() const {
   // @@protoc_insertion_point(field_get:epoch.DeviceComm.mac_src)
   return _internal_mac_src();
 }
-inline void DeviceComm::_internal_set_mac_src(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void DeviceComm::_internal_set_mac_src(uint64_t value) {
   
-  mac_src_ = value;
+  _impl_.mac_src_ = value;
 }
-inline void DeviceComm::set_mac_src(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void DeviceComm::set_mac_src(uint64_t value) {
   _internal_set_mac_src(value);
   // @@protoc_insertion_point(field_set:epoch.DeviceComm.mac_src)
 }
 
 // repeated .epoch.L2Summary tx_summary = 2;
 inline int DeviceComm::_internal_tx_summary_size() const {
-  return tx_summary_.size();
+  return _impl_.tx_summary_.size();
 }
 inline int DeviceComm::tx_summary_size() const {
   return _internal_tx_summary_size();
 }
 inline void DeviceComm::clear_tx_summary() {
-  tx_summary_.Clear();
+  _impl_.tx_summary_.Clear();
 }
 inline ::epoch::L2Summary* DeviceComm::mutable_tx_summary(int index) {
   // @@protoc_insertion_point(field_mutable:epoch.DeviceComm.tx_summary)
-  return tx_summary_.Mutable(index);
+  return _impl_.tx_summary_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::epoch::L2Summary >*
 DeviceComm::mutable_tx_summary() {
   // @@protoc_insertion_point(field_mutable_list:epoch.DeviceComm.tx_summary)
-  return &tx_summary_;
+  return &_impl_.tx_summary_;
 }
 inline const ::epoch::L2Summary& DeviceComm::_internal_tx_summary(int index) const {
-  return tx_summary_.Get(index);
+  return _impl_.tx_summary_.Get(index);
 }
 inline const ::epoch::L2Summary& DeviceComm::tx_summary(int index) const {
   // @@protoc_insertion_point(field_get:epoch.DeviceComm.tx_summary)
   return _internal_tx_summary(index);
 }
 inline ::epoch::L2Summary* DeviceComm::_internal_add_tx_summary() {
-  return tx_summary_.Add();
+  return _impl_.tx_summary_.Add();
 }
 inline ::epoch::L2Summary* DeviceComm::add_tx_summary() {
+  ::epoch::L2Summary* _add = _internal_add_tx_summary();
   // @@protoc_insertion_point(field_add:epoch.DeviceComm.tx_summary)
-  return _internal_add_tx_summary();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::epoch::L2Summary >&
 DeviceComm::tx_summary() const {
   // @@protoc_insertion_point(field_list:epoch.DeviceComm.tx_summary)
-  return tx_summary_;
+  return _impl_.tx_summary_;
 }
 
 // .epoch.L2Summary bcast_33 = 3;
 inline bool DeviceComm::_internal_has_bcast_33() const {
-  return this != internal_default_instance() && bcast_33_ != nullptr;
+  return this != internal_default_instance() && _impl_.bcast_33_ != nullptr;
 }
 inline bool DeviceComm::has_bcast_33() const {
   return _internal_has_bcast_33();
 }
 inline void DeviceComm::clear_bcast_33() {
-  if (GetArena() == nullptr && bcast_33_ != nullptr) {
-    delete bcast_33_;
+  if (GetArenaForAllocation() == nullptr && _impl_.bcast_33_ != nullptr) {
+    delete _impl_.bcast_33_;
   }
-  bcast_33_ = nullptr;
+  _impl_.bcast_33_ = nullptr;
 }
 inline const ::epoch::L2Summary& DeviceComm::_internal_bcast_33() const {
-  const ::epoch::L2Summary* p = bcast_33_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::epoch::L2Summary*>(
-      &::epoch::_L2Summary_default_instance_);
+  const ::epoch::L2Summary* p = _impl_.bcast_33_;
+  return p != nullptr ? *p : reinterpret_cast<const ::epoch::L2Summary&>(
+      ::epoch::_L2Summary_default_instance_);
 }
 inline const ::epoch::L2Summary& DeviceComm::bcast_33() const {
   // @@protoc_insertion_point(field_get:epoch.DeviceComm.bcast_33)
@@ -1134,10 +1735,10 @@ inline const ::epoch::L2Summary& DeviceComm::bcast_33() const {
 }
 inline void DeviceComm::unsafe_arena_set_allocated_bcast_33(
     ::epoch::L2Summary* bcast_33) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bcast_33_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.bcast_33_);
   }
-  bcast_33_ = bcast_33;
+  _impl_.bcast_33_ = bcast_33;
   if (bcast_33) {
     
   } else {
@@ -1146,39 +1747,48 @@ inline void DeviceComm::unsafe_arena_set_allocated_bcast_33(
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:epoch.DeviceComm.bcast_33)
 }
 inline ::epoch::L2Summary* DeviceComm::release_bcast_33() {
-  auto temp = unsafe_arena_release_bcast_33();
-  if (GetArena() != nullptr) {
+  
+  ::epoch::L2Summary* temp = _impl_.bcast_33_;
+  _impl_.bcast_33_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::epoch::L2Summary* DeviceComm::unsafe_arena_release_bcast_33() {
   // @@protoc_insertion_point(field_release:epoch.DeviceComm.bcast_33)
   
-  ::epoch::L2Summary* temp = bcast_33_;
-  bcast_33_ = nullptr;
+  ::epoch::L2Summary* temp = _impl_.bcast_33_;
+  _impl_.bcast_33_ = nullptr;
   return temp;
 }
 inline ::epoch::L2Summary* DeviceComm::_internal_mutable_bcast_33() {
   
-  if (bcast_33_ == nullptr) {
-    auto* p = CreateMaybeMessage<::epoch::L2Summary>(GetArena());
-    bcast_33_ = p;
+  if (_impl_.bcast_33_ == nullptr) {
+    auto* p = CreateMaybeMessage<::epoch::L2Summary>(GetArenaForAllocation());
+    _impl_.bcast_33_ = p;
   }
-  return bcast_33_;
+  return _impl_.bcast_33_;
 }
 inline ::epoch::L2Summary* DeviceComm::mutable_bcast_33() {
+  ::epoch::L2Summary* _msg = _internal_mutable_bcast_33();
   // @@protoc_insertion_point(field_mutable:epoch.DeviceComm.bcast_33)
-  return _internal_mutable_bcast_33();
+  return _msg;
 }
 inline void DeviceComm::set_allocated_bcast_33(::epoch::L2Summary* bcast_33) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete bcast_33_;
+    delete _impl_.bcast_33_;
   }
   if (bcast_33) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(bcast_33);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(bcast_33);
     if (message_arena != submessage_arena) {
       bcast_33 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, bcast_33, submessage_arena);
@@ -1187,27 +1797,27 @@ inline void DeviceComm::set_allocated_bcast_33(::epoch::L2Summary* bcast_33) {
   } else {
     
   }
-  bcast_33_ = bcast_33;
+  _impl_.bcast_33_ = bcast_33;
   // @@protoc_insertion_point(field_set_allocated:epoch.DeviceComm.bcast_33)
 }
 
 // .epoch.L2Summary bcast_ff = 4;
 inline bool DeviceComm::_internal_has_bcast_ff() const {
-  return this != internal_default_instance() && bcast_ff_ != nullptr;
+  return this != internal_default_instance() && _impl_.bcast_ff_ != nullptr;
 }
 inline bool DeviceComm::has_bcast_ff() const {
   return _internal_has_bcast_ff();
 }
 inline void DeviceComm::clear_bcast_ff() {
-  if (GetArena() == nullptr && bcast_ff_ != nullptr) {
-    delete bcast_ff_;
+  if (GetArenaForAllocation() == nullptr && _impl_.bcast_ff_ != nullptr) {
+    delete _impl_.bcast_ff_;
   }
-  bcast_ff_ = nullptr;
+  _impl_.bcast_ff_ = nullptr;
 }
 inline const ::epoch::L2Summary& DeviceComm::_internal_bcast_ff() const {
-  const ::epoch::L2Summary* p = bcast_ff_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::epoch::L2Summary*>(
-      &::epoch::_L2Summary_default_instance_);
+  const ::epoch::L2Summary* p = _impl_.bcast_ff_;
+  return p != nullptr ? *p : reinterpret_cast<const ::epoch::L2Summary&>(
+      ::epoch::_L2Summary_default_instance_);
 }
 inline const ::epoch::L2Summary& DeviceComm::bcast_ff() const {
   // @@protoc_insertion_point(field_get:epoch.DeviceComm.bcast_ff)
@@ -1215,10 +1825,10 @@ inline const ::epoch::L2Summary& DeviceComm::bcast_ff() const {
 }
 inline void DeviceComm::unsafe_arena_set_allocated_bcast_ff(
     ::epoch::L2Summary* bcast_ff) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bcast_ff_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.bcast_ff_);
   }
-  bcast_ff_ = bcast_ff;
+  _impl_.bcast_ff_ = bcast_ff;
   if (bcast_ff) {
     
   } else {
@@ -1227,39 +1837,48 @@ inline void DeviceComm::unsafe_arena_set_allocated_bcast_ff(
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:epoch.DeviceComm.bcast_ff)
 }
 inline ::epoch::L2Summary* DeviceComm::release_bcast_ff() {
-  auto temp = unsafe_arena_release_bcast_ff();
-  if (GetArena() != nullptr) {
+  
+  ::epoch::L2Summary* temp = _impl_.bcast_ff_;
+  _impl_.bcast_ff_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::epoch::L2Summary* DeviceComm::unsafe_arena_release_bcast_ff() {
   // @@protoc_insertion_point(field_release:epoch.DeviceComm.bcast_ff)
   
-  ::epoch::L2Summary* temp = bcast_ff_;
-  bcast_ff_ = nullptr;
+  ::epoch::L2Summary* temp = _impl_.bcast_ff_;
+  _impl_.bcast_ff_ = nullptr;
   return temp;
 }
 inline ::epoch::L2Summary* DeviceComm::_internal_mutable_bcast_ff() {
   
-  if (bcast_ff_ == nullptr) {
-    auto* p = CreateMaybeMessage<::epoch::L2Summary>(GetArena());
-    bcast_ff_ = p;
+  if (_impl_.bcast_ff_ == nullptr) {
+    auto* p = CreateMaybeMessage<::epoch::L2Summary>(GetArenaForAllocation());
+    _impl_.bcast_ff_ = p;
   }
-  return bcast_ff_;
+  return _impl_.bcast_ff_;
 }
 inline ::epoch::L2Summary* DeviceComm::mutable_bcast_ff() {
+  ::epoch::L2Summary* _msg = _internal_mutable_bcast_ff();
   // @@protoc_insertion_point(field_mutable:epoch.DeviceComm.bcast_ff)
-  return _internal_mutable_bcast_ff();
+  return _msg;
 }
 inline void DeviceComm::set_allocated_bcast_ff(::epoch::L2Summary* bcast_ff) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete bcast_ff_;
+    delete _impl_.bcast_ff_;
   }
   if (bcast_ff) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(bcast_ff);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(bcast_ff);
     if (message_arena != submessage_arena) {
       bcast_ff = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, bcast_ff, submessage_arena);
@@ -1268,27 +1887,27 @@ inline void DeviceComm::set_allocated_bcast_ff(::epoch::L2Summary* bcast_ff) {
   } else {
     
   }
-  bcast_ff_ = bcast_ff;
+  _impl_.bcast_ff_ = bcast_ff;
   // @@protoc_insertion_point(field_set_allocated:epoch.DeviceComm.bcast_ff)
 }
 
 // .epoch.L2Summary bcast_01 = 5;
 inline bool DeviceComm::_internal_has_bcast_01() const {
-  return this != internal_default_instance() && bcast_01_ != nullptr;
+  return this != internal_default_instance() && _impl_.bcast_01_ != nullptr;
 }
 inline bool DeviceComm::has_bcast_01() const {
   return _internal_has_bcast_01();
 }
 inline void DeviceComm::clear_bcast_01() {
-  if (GetArena() == nullptr && bcast_01_ != nullptr) {
-    delete bcast_01_;
+  if (GetArenaForAllocation() == nullptr && _impl_.bcast_01_ != nullptr) {
+    delete _impl_.bcast_01_;
   }
-  bcast_01_ = nullptr;
+  _impl_.bcast_01_ = nullptr;
 }
 inline const ::epoch::L2Summary& DeviceComm::_internal_bcast_01() const {
-  const ::epoch::L2Summary* p = bcast_01_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::epoch::L2Summary*>(
-      &::epoch::_L2Summary_default_instance_);
+  const ::epoch::L2Summary* p = _impl_.bcast_01_;
+  return p != nullptr ? *p : reinterpret_cast<const ::epoch::L2Summary&>(
+      ::epoch::_L2Summary_default_instance_);
 }
 inline const ::epoch::L2Summary& DeviceComm::bcast_01() const {
   // @@protoc_insertion_point(field_get:epoch.DeviceComm.bcast_01)
@@ -1296,10 +1915,10 @@ inline const ::epoch::L2Summary& DeviceComm::bcast_01() const {
 }
 inline void DeviceComm::unsafe_arena_set_allocated_bcast_01(
     ::epoch::L2Summary* bcast_01) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bcast_01_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.bcast_01_);
   }
-  bcast_01_ = bcast_01;
+  _impl_.bcast_01_ = bcast_01;
   if (bcast_01) {
     
   } else {
@@ -1308,39 +1927,48 @@ inline void DeviceComm::unsafe_arena_set_allocated_bcast_01(
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:epoch.DeviceComm.bcast_01)
 }
 inline ::epoch::L2Summary* DeviceComm::release_bcast_01() {
-  auto temp = unsafe_arena_release_bcast_01();
-  if (GetArena() != nullptr) {
+  
+  ::epoch::L2Summary* temp = _impl_.bcast_01_;
+  _impl_.bcast_01_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::epoch::L2Summary* DeviceComm::unsafe_arena_release_bcast_01() {
   // @@protoc_insertion_point(field_release:epoch.DeviceComm.bcast_01)
   
-  ::epoch::L2Summary* temp = bcast_01_;
-  bcast_01_ = nullptr;
+  ::epoch::L2Summary* temp = _impl_.bcast_01_;
+  _impl_.bcast_01_ = nullptr;
   return temp;
 }
 inline ::epoch::L2Summary* DeviceComm::_internal_mutable_bcast_01() {
   
-  if (bcast_01_ == nullptr) {
-    auto* p = CreateMaybeMessage<::epoch::L2Summary>(GetArena());
-    bcast_01_ = p;
+  if (_impl_.bcast_01_ == nullptr) {
+    auto* p = CreateMaybeMessage<::epoch::L2Summary>(GetArenaForAllocation());
+    _impl_.bcast_01_ = p;
   }
-  return bcast_01_;
+  return _impl_.bcast_01_;
 }
 inline ::epoch::L2Summary* DeviceComm::mutable_bcast_01() {
+  ::epoch::L2Summary* _msg = _internal_mutable_bcast_01();
   // @@protoc_insertion_point(field_mutable:epoch.DeviceComm.bcast_01)
-  return _internal_mutable_bcast_01();
+  return _msg;
 }
 inline void DeviceComm::set_allocated_bcast_01(::epoch::L2Summary* bcast_01) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete bcast_01_;
+    delete _impl_.bcast_01_;
   }
   if (bcast_01) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(bcast_01);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(bcast_01);
     if (message_arena != submessage_arena) {
       bcast_01 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, bcast_01, submessage_arena);
@@ -1349,79 +1977,88 @@ inline void DeviceComm::set_allocated_bcast_01(::epoch::L2Summary* bcast_01) {
   } else {
     
   }
-  bcast_01_ = bcast_01;
+  _impl_.bcast_01_ = bcast_01;
   // @@protoc_insertion_point(field_set_allocated:epoch.DeviceComm.bcast_01)
 }
 
-// .epoch.L2Summary bcast_XX = 6;
+// .epoch.L2Summary bcast_xx = 6;
 inline bool DeviceComm::_internal_has_bcast_xx() const {
-  return this != internal_default_instance() && bcast_xx_ != nullptr;
+  return this != internal_default_instance() && _impl_.bcast_xx_ != nullptr;
 }
 inline bool DeviceComm::has_bcast_xx() const {
   return _internal_has_bcast_xx();
 }
 inline void DeviceComm::clear_bcast_xx() {
-  if (GetArena() == nullptr && bcast_xx_ != nullptr) {
-    delete bcast_xx_;
+  if (GetArenaForAllocation() == nullptr && _impl_.bcast_xx_ != nullptr) {
+    delete _impl_.bcast_xx_;
   }
-  bcast_xx_ = nullptr;
+  _impl_.bcast_xx_ = nullptr;
 }
 inline const ::epoch::L2Summary& DeviceComm::_internal_bcast_xx() const {
-  const ::epoch::L2Summary* p = bcast_xx_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::epoch::L2Summary*>(
-      &::epoch::_L2Summary_default_instance_);
+  const ::epoch::L2Summary* p = _impl_.bcast_xx_;
+  return p != nullptr ? *p : reinterpret_cast<const ::epoch::L2Summary&>(
+      ::epoch::_L2Summary_default_instance_);
 }
 inline const ::epoch::L2Summary& DeviceComm::bcast_xx() const {
-  // @@protoc_insertion_point(field_get:epoch.DeviceComm.bcast_XX)
+  // @@protoc_insertion_point(field_get:epoch.DeviceComm.bcast_xx)
   return _internal_bcast_xx();
 }
 inline void DeviceComm::unsafe_arena_set_allocated_bcast_xx(
     ::epoch::L2Summary* bcast_xx) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bcast_xx_);
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.bcast_xx_);
   }
-  bcast_xx_ = bcast_xx;
+  _impl_.bcast_xx_ = bcast_xx;
   if (bcast_xx) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:epoch.DeviceComm.bcast_XX)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:epoch.DeviceComm.bcast_xx)
 }
 inline ::epoch::L2Summary* DeviceComm::release_bcast_xx() {
-  auto temp = unsafe_arena_release_bcast_xx();
-  if (GetArena() != nullptr) {
+  
+  ::epoch::L2Summary* temp = _impl_.bcast_xx_;
+  _impl_.bcast_xx_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
   return temp;
 }
 inline ::epoch::L2Summary* DeviceComm::unsafe_arena_release_bcast_xx() {
-  // @@protoc_insertion_point(field_release:epoch.DeviceComm.bcast_XX)
+  // @@protoc_insertion_point(field_release:epoch.DeviceComm.bcast_xx)
   
-  ::epoch::L2Summary* temp = bcast_xx_;
-  bcast_xx_ = nullptr;
+  ::epoch::L2Summary* temp = _impl_.bcast_xx_;
+  _impl_.bcast_xx_ = nullptr;
   return temp;
 }
 inline ::epoch::L2Summary* DeviceComm::_internal_mutable_bcast_xx() {
   
-  if (bcast_xx_ == nullptr) {
-    auto* p = CreateMaybeMessage<::epoch::L2Summary>(GetArena());
-    bcast_xx_ = p;
+  if (_impl_.bcast_xx_ == nullptr) {
+    auto* p = CreateMaybeMessage<::epoch::L2Summary>(GetArenaForAllocation());
+    _impl_.bcast_xx_ = p;
   }
-  return bcast_xx_;
+  return _impl_.bcast_xx_;
 }
 inline ::epoch::L2Summary* DeviceComm::mutable_bcast_xx() {
-  // @@protoc_insertion_point(field_mutable:epoch.DeviceComm.bcast_XX)
-  return _internal_mutable_bcast_xx();
+  ::epoch::L2Summary* _msg = _internal_mutable_bcast_xx();
+  // @@protoc_insertion_point(field_mutable:epoch.DeviceComm.bcast_xx)
+  return _msg;
 }
 inline void DeviceComm::set_allocated_bcast_xx(::epoch::L2Summary* bcast_xx) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
   if (message_arena == nullptr) {
-    delete bcast_xx_;
+    delete _impl_.bcast_xx_;
   }
   if (bcast_xx) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(bcast_xx);
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(bcast_xx);
     if (message_arena != submessage_arena) {
       bcast_xx = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, bcast_xx, submessage_arena);
@@ -1430,8 +2067,28 @@ inline void DeviceComm::set_allocated_bcast_xx(::epoch::L2Summary* bcast_xx) {
   } else {
     
   }
-  bcast_xx_ = bcast_xx;
-  // @@protoc_insertion_point(field_set_allocated:epoch.DeviceComm.bcast_XX)
+  _impl_.bcast_xx_ = bcast_xx;
+  // @@protoc_insertion_point(field_set_allocated:epoch.DeviceComm.bcast_xx)
+}
+
+// uint32 src_id = 7;
+inline void DeviceComm::clear_src_id() {
+  _impl_.src_id_ = 0u;
+}
+inline uint32_t DeviceComm::_internal_src_id() const {
+  return _impl_.src_id_;
+}
+inline uint32_t DeviceComm::src_id() const {
+  // @@protoc_insertion_point(field_get:epoch.DeviceComm.src_id)
+  return _internal_src_id();
+}
+inline void DeviceComm::_internal_set_src_id(uint32_t value) {
+  
+  _impl_.src_id_ = value;
+}
+inline void DeviceComm::set_src_id(uint32_t value) {
+  _internal_set_src_id(value);
+  // @@protoc_insertion_point(field_set:epoch.DeviceComm.src_id)
 }
 
 // -------------------------------------------------------------------
@@ -1440,105 +2097,694 @@ inline void DeviceComm::set_allocated_bcast_xx(::epoch::L2Summary* bcast_xx) {
 
 // fixed64 mac_src = 1;
 inline void AddrAssoc::clear_mac_src() {
-  mac_src_ = PROTOBUF_ULONGLONG(0);
+  _impl_.mac_src_ = uint64_t{0u};
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 AddrAssoc::_internal_mac_src() const {
-  return mac_src_;
+inline uint64_t AddrAssoc::_internal_mac_src() const {
+  return _impl_.mac_src_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 AddrAssoc::mac_src() const {
+inline uint64_t AddrAssoc::mac_src() const {
   // @@protoc_insertion_point(field_get:epoch.AddrAssoc.mac_src)
   return _internal_mac_src();
 }
-inline void AddrAssoc::_internal_set_mac_src(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void AddrAssoc::_internal_set_mac_src(uint64_t value) {
   
-  mac_src_ = value;
+  _impl_.mac_src_ = value;
 }
-inline void AddrAssoc::set_mac_src(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void AddrAssoc::set_mac_src(uint64_t value) {
   _internal_set_mac_src(value);
   // @@protoc_insertion_point(field_set:epoch.AddrAssoc.mac_src)
 }
 
 // fixed32 ipv4 = 2;
 inline void AddrAssoc::clear_ipv4() {
-  ipv4_ = 0u;
+  _impl_.ipv4_ = 0u;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 AddrAssoc::_internal_ipv4() const {
-  return ipv4_;
+inline uint32_t AddrAssoc::_internal_ipv4() const {
+  return _impl_.ipv4_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint32 AddrAssoc::ipv4() const {
+inline uint32_t AddrAssoc::ipv4() const {
   // @@protoc_insertion_point(field_get:epoch.AddrAssoc.ipv4)
   return _internal_ipv4();
 }
-inline void AddrAssoc::_internal_set_ipv4(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void AddrAssoc::_internal_set_ipv4(uint32_t value) {
   
-  ipv4_ = value;
+  _impl_.ipv4_ = value;
 }
-inline void AddrAssoc::set_ipv4(::PROTOBUF_NAMESPACE_ID::uint32 value) {
+inline void AddrAssoc::set_ipv4(uint32_t value) {
   _internal_set_ipv4(value);
   // @@protoc_insertion_point(field_set:epoch.AddrAssoc.ipv4)
 }
 
+// uint32 id = 3;
+inline void AddrAssoc::clear_id() {
+  _impl_.id_ = 0u;
+}
+inline uint32_t AddrAssoc::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint32_t AddrAssoc::id() const {
+  // @@protoc_insertion_point(field_get:epoch.AddrAssoc.id)
+  return _internal_id();
+}
+inline void AddrAssoc::_internal_set_id(uint32_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void AddrAssoc::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:epoch.AddrAssoc.id)
+}
+
 // -------------------------------------------------------------------
 
 // ArpAssoc
 
 // fixed64 mac_src = 1;
 inline void ArpAssoc::clear_mac_src() {
-  mac_src_ = PROTOBUF_ULONGLONG(0);
+  _impl_.mac_src_ = uint64_t{0u};
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 ArpAssoc::_internal_mac_src() const {
-  return mac_src_;
+inline uint64_t ArpAssoc::_internal_mac_src() const {
+  return _impl_.mac_src_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 ArpAssoc::mac_src() const {
+inline uint64_t ArpAssoc::mac_src() const {
   // @@protoc_insertion_point(field_get:epoch.ArpAssoc.mac_src)
   return _internal_mac_src();
 }
-inline void ArpAssoc::_internal_set_mac_src(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void ArpAssoc::_internal_set_mac_src(uint64_t value) {
   
-  mac_src_ = value;
+  _impl_.mac_src_ = value;
 }
-inline void ArpAssoc::set_mac_src(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void ArpAssoc::set_mac_src(uint64_t value) {
   _internal_set_mac_src(value);
   // @@protoc_insertion_point(field_set:epoch.ArpAssoc.mac_src)
 }
 
 // repeated .epoch.AddrAssoc table_row = 2;
 inline int ArpAssoc::_internal_table_row_size() const {
-  return table_row_.size();
+  return _impl_.table_row_.size();
 }
 inline int ArpAssoc::table_row_size() const {
   return _internal_table_row_size();
 }
 inline void ArpAssoc::clear_table_row() {
-  table_row_.Clear();
+  _impl_.table_row_.Clear();
 }
 inline ::epoch::AddrAssoc* ArpAssoc::mutable_table_row(int index) {
   // @@protoc_insertion_point(field_mutable:epoch.ArpAssoc.table_row)
-  return table_row_.Mutable(index);
+  return _impl_.table_row_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::epoch::AddrAssoc >*
 ArpAssoc::mutable_table_row() {
   // @@protoc_insertion_point(field_mutable_list:epoch.ArpAssoc.table_row)
-  return &table_row_;
+  return &_impl_.table_row_;
 }
 inline const ::epoch::AddrAssoc& ArpAssoc::_internal_table_row(int index) const {
-  return table_row_.Get(index);
+  return _impl_.table_row_.Get(index);
 }
 inline const ::epoch::AddrAssoc& ArpAssoc::table_row(int index) const {
   // @@protoc_insertion_point(field_get:epoch.ArpAssoc.table_row)
   return _internal_table_row(index);
 }
 inline ::epoch::AddrAssoc* ArpAssoc::_internal_add_table_row() {
-  return table_row_.Add();
+  return _impl_.table_row_.Add();
 }
 inline ::epoch::AddrAssoc* ArpAssoc::add_table_row() {
+  ::epoch::AddrAssoc* _add = _internal_add_table_row();
   // @@protoc_insertion_point(field_add:epoch.ArpAssoc.table_row)
-  return _internal_add_table_row();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::epoch::AddrAssoc >&
 ArpAssoc::table_row() const {
   // @@protoc_insertion_point(field_list:epoch.ArpAssoc.table_row)
-  return table_row_;
+  return _impl_.table_row_;
+}
+
+// -------------------------------------------------------------------
+
+// L2Columns
+
+// repeated uint32 src_id = 1;
+inline int L2Columns::_internal_src_id_size() const {
+  return _impl_.src_id_.size();
+}
+inline int L2Columns::src_id_size() const {
+  return _internal_src_id_size();
+}
+inline void L2Columns::clear_src_id() {
+  _impl_.src_id_.Clear();
+}
+inline uint32_t L2Columns::_internal_src_id(int index) const {
+  return _impl_.src_id_.Get(index);
+}
+inline uint32_t L2Columns::src_id(int index) const {
+  // @@protoc_insertion_point(field_get:epoch.L2Columns.src_id)
+  return _internal_src_id(index);
+}
+inline void L2Columns::set_src_id(int index, uint32_t value) {
+  _impl_.src_id_.Set(index, value);
+  // @@protoc_insertion_point(field_set:epoch.L2Columns.src_id)
+}
+inline void L2Columns::_internal_add_src_id(uint32_t value) {
+  _impl_.src_id_.Add(value);
+}
+inline void L2Columns::add_src_id(uint32_t value) {
+  _internal_add_src_id(value);
+  // @@protoc_insertion_point(field_add:epoch.L2Columns.src_id)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::_internal_src_id() const {
+  return _impl_.src_id_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::src_id() const {
+  // @@protoc_insertion_point(field_list:epoch.L2Columns.src_id)
+  return _internal_src_id();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::_internal_mutable_src_id() {
+  return &_impl_.src_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::mutable_src_id() {
+  // @@protoc_insertion_point(field_mutable_list:epoch.L2Columns.src_id)
+  return _internal_mutable_src_id();
+}
+
+// repeated uint32 dst_id = 2;
+inline int L2Columns::_internal_dst_id_size() const {
+  return _impl_.dst_id_.size();
+}
+inline int L2Columns::dst_id_size() const {
+  return _internal_dst_id_size();
+}
+inline void L2Columns::clear_dst_id() {
+  _impl_.dst_id_.Clear();
+}
+inline uint32_t L2Columns::_internal_dst_id(int index) const {
+  return _impl_.dst_id_.Get(index);
+}
+inline uint32_t L2Columns::dst_id(int index) const {
+  // @@protoc_insertion_point(field_get:epoch.L2Columns.dst_id)
+  return _internal_dst_id(index);
+}
+inline void L2Columns::set_dst_id(int index, uint32_t value) {
+  _impl_.dst_id_.Set(index, value);
+  // @@protoc_insertion_point(field_set:epoch.L2Columns.dst_id)
+}
+inline void L2Columns::_internal_add_dst_id(uint32_t value) {
+  _impl_.dst_id_.Add(value);
+}
+inline void L2Columns::add_dst_id(uint32_t value) {
+  _internal_add_dst_id(value);
+  // @@protoc_insertion_point(field_add:epoch.L2Columns.dst_id)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::_internal_dst_id() const {
+  return _impl_.dst_id_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::dst_id() const {
+  // @@protoc_insertion_point(field_list:epoch.L2Columns.dst_id)
+  return _internal_dst_id();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::_internal_mutable_dst_id() {
+  return &_impl_.dst_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::mutable_dst_id() {
+  // @@protoc_insertion_point(field_mutable_list:epoch.L2Columns.dst_id)
+  return _internal_mutable_dst_id();
+}
+
+// repeated uint32 ipv4 = 3;
+inline int L2Columns::_internal_ipv4_size() const {
+  return _impl_.ipv4_.size();
+}
+inline int L2Columns::ipv4_size() const {
+  return _internal_ipv4_size();
+}
+inline void L2Columns::clear_ipv4() {
+  _impl_.ipv4_.Clear();
+}
+inline uint32_t L2Columns::_internal_ipv4(int index) const {
+  return _impl_.ipv4_.Get(index);
+}
+inline uint32_t L2Columns::ipv4(int index) const {
+  // @@protoc_insertion_point(field_get:epoch.L2Columns.ipv4)
+  return _internal_ipv4(index);
+}
+inline void L2Columns::set_ipv4(int index, uint32_t value) {
+  _impl_.ipv4_.Set(index, value);
+  // @@protoc_insertion_point(field_set:epoch.L2Columns.ipv4)
+}
+inline void L2Columns::_internal_add_ipv4(uint32_t value) {
+  _impl_.ipv4_.Add(value);
+}
+inline void L2Columns::add_ipv4(uint32_t value) {
+  _internal_add_ipv4(value);
+  // @@protoc_insertion_point(field_add:epoch.L2Columns.ipv4)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::_internal_ipv4() const {
+  return _impl_.ipv4_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::ipv4() const {
+  // @@protoc_insertion_point(field_list:epoch.L2Columns.ipv4)
+  return _internal_ipv4();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::_internal_mutable_ipv4() {
+  return &_impl_.ipv4_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::mutable_ipv4() {
+  // @@protoc_insertion_point(field_mutable_list:epoch.L2Columns.ipv4)
+  return _internal_mutable_ipv4();
+}
+
+// repeated uint32 ipv6 = 4;
+inline int L2Columns::_internal_ipv6_size() const {
+  return _impl_.ipv6_.size();
+}
+inline int L2Columns::ipv6_size() const {
+  return _internal_ipv6_size();
+}
+inline void L2Columns::clear_ipv6() {
+  _impl_.ipv6_.Clear();
+}
+inline uint32_t L2Columns::_internal_ipv6(int index) const {
+  return _impl_.ipv6_.Get(index);
+}
+inline uint32_t L2Columns::ipv6(int index) const {
+  // @@protoc_insertion_point(field_get:epoch.L2Columns.ipv6)
+  return _internal_ipv6(index);
+}
+inline void L2Columns::set_ipv6(int index, uint32_t value) {
+  _impl_.ipv6_.Set(index, value);
+  // @@protoc_insertion_point(field_set:epoch.L2Columns.ipv6)
+}
+inline void L2Columns::_internal_add_ipv6(uint32_t value) {
+  _impl_.ipv6_.Add(value);
+}
+inline void L2Columns::add_ipv6(uint32_t value) {
+  _internal_add_ipv6(value);
+  // @@protoc_insertion_point(field_add:epoch.L2Columns.ipv6)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::_internal_ipv6() const {
+  return _impl_.ipv6_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::ipv6() const {
+  // @@protoc_insertion_point(field_list:epoch.L2Columns.ipv6)
+  return _internal_ipv6();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::_internal_mutable_ipv6() {
+  return &_impl_.ipv6_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::mutable_ipv6() {
+  // @@protoc_insertion_point(field_mutable_list:epoch.L2Columns.ipv6)
+  return _internal_mutable_ipv6();
+}
+
+// repeated uint32 arp = 5;
+inline int L2Columns::_internal_arp_size() const {
+  return _impl_.arp_.size();
+}
+inline int L2Columns::arp_size() const {
+  return _internal_arp_size();
+}
+inline void L2Columns::clear_arp() {
+  _impl_.arp_.Clear();
+}
+inline uint32_t L2Columns::_internal_arp(int index) const {
+  return _impl_.arp_.Get(index);
+}
+inline uint32_t L2Columns::arp(int index) const {
+  // @@protoc_insertion_point(field_get:epoch.L2Columns.arp)
+  return _internal_arp(index);
+}
+inline void L2Columns::set_arp(int index, uint32_t value) {
+  _impl_.arp_.Set(index, value);
+  // @@protoc_insertion_point(field_set:epoch.L2Columns.arp)
+}
+inline void L2Columns::_internal_add_arp(uint32_t value) {
+  _impl_.arp_.Add(value);
+}
+inline void L2Columns::add_arp(uint32_t value) {
+  _internal_add_arp(value);
+  // @@protoc_insertion_point(field_add:epoch.L2Columns.arp)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::_internal_arp() const {
+  return _impl_.arp_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::arp() const {
+  // @@protoc_insertion_point(field_list:epoch.L2Columns.arp)
+  return _internal_arp();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::_internal_mutable_arp() {
+  return &_impl_.arp_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::mutable_arp() {
+  // @@protoc_insertion_point(field_mutable_list:epoch.L2Columns.arp)
+  return _internal_mutable_arp();
+}
+
+// repeated uint32 unknown = 6;
+inline int L2Columns::_internal_unknown_size() const {
+  return _impl_.unknown_.size();
+}
+inline int L2Columns::unknown_size() const {
+  return _internal_unknown_size();
+}
+inline void L2Columns::clear_unknown() {
+  _impl_.unknown_.Clear();
+}
+inline uint32_t L2Columns::_internal_unknown(int index) const {
+  return _impl_.unknown_.Get(index);
+}
+inline uint32_t L2Columns::unknown(int index) const {
+  // @@protoc_insertion_point(field_get:epoch.L2Columns.unknown)
+  return _internal_unknown(index);
+}
+inline void L2Columns::set_unknown(int index, uint32_t value) {
+  _impl_.unknown_.Set(index, value);
+  // @@protoc_insertion_point(field_set:epoch.L2Columns.unknown)
+}
+inline void L2Columns::_internal_add_unknown(uint32_t value) {
+  _impl_.unknown_.Add(value);
+}
+inline void L2Columns::add_unknown(uint32_t value) {
+  _internal_add_unknown(value);
+  // @@protoc_insertion_point(field_add:epoch.L2Columns.unknown)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::_internal_unknown() const {
+  return _impl_.unknown_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::unknown() const {
+  // @@protoc_insertion_point(field_list:epoch.L2Columns.unknown)
+  return _internal_unknown();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::_internal_mutable_unknown() {
+  return &_impl_.unknown_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::mutable_unknown() {
+  // @@protoc_insertion_point(field_mutable_list:epoch.L2Columns.unknown)
+  return _internal_mutable_unknown();
+}
+
+// repeated uint32 bcast_src_id = 7;
+inline int L2Columns::_internal_bcast_src_id_size() const {
+  return _impl_.bcast_src_id_.size();
+}
+inline int L2Columns::bcast_src_id_size() const {
+  return _internal_bcast_src_id_size();
+}
+inline void L2Columns::clear_bcast_src_id() {
+  _impl_.bcast_src_id_.Clear();
+}
+inline uint32_t L2Columns::_internal_bcast_src_id(int index) const {
+  return _impl_.bcast_src_id_.Get(index);
+}
+inline uint32_t L2Columns::bcast_src_id(int index) const {
+  // @@protoc_insertion_point(field_get:epoch.L2Columns.bcast_src_id)
+  return _internal_bcast_src_id(index);
+}
+inline void L2Columns::set_bcast_src_id(int index, uint32_t value) {
+  _impl_.bcast_src_id_.Set(index, value);
+  // @@protoc_insertion_point(field_set:epoch.L2Columns.bcast_src_id)
+}
+inline void L2Columns::_internal_add_bcast_src_id(uint32_t value) {
+  _impl_.bcast_src_id_.Add(value);
+}
+inline void L2Columns::add_bcast_src_id(uint32_t value) {
+  _internal_add_bcast_src_id(value);
+  // @@protoc_insertion_point(field_add:epoch.L2Columns.bcast_src_id)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::_internal_bcast_src_id() const {
+  return _impl_.bcast_src_id_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::bcast_src_id() const {
+  // @@protoc_insertion_point(field_list:epoch.L2Columns.bcast_src_id)
+  return _internal_bcast_src_id();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::_internal_mutable_bcast_src_id() {
+  return &_impl_.bcast_src_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::mutable_bcast_src_id() {
+  // @@protoc_insertion_point(field_mutable_list:epoch.L2Columns.bcast_src_id)
+  return _internal_mutable_bcast_src_id();
+}
+
+// repeated uint32 bcast_pool = 8;
+inline int L2Columns::_internal_bcast_pool_size() const {
+  return _impl_.bcast_pool_.size();
+}
+inline int L2Columns::bcast_pool_size() const {
+  return _internal_bcast_pool_size();
+}
+inline void L2Columns::clear_bcast_pool() {
+  _impl_.bcast_pool_.Clear();
+}
+inline uint32_t L2Columns::_internal_bcast_pool(int index) const {
+  return _impl_.bcast_pool_.Get(index);
+}
+inline uint32_t L2Columns::bcast_pool(int index) const {
+  // @@protoc_insertion_point(field_get:epoch.L2Columns.bcast_pool)
+  return _internal_bcast_pool(index);
+}
+inline void L2Columns::set_bcast_pool(int index, uint32_t value) {
+  _impl_.bcast_pool_.Set(index, value);
+  // @@protoc_insertion_point(field_set:epoch.L2Columns.bcast_pool)
+}
+inline void L2Columns::_internal_add_bcast_pool(uint32_t value) {
+  _impl_.bcast_pool_.Add(value);
+}
+inline void L2Columns::add_bcast_pool(uint32_t value) {
+  _internal_add_bcast_pool(value);
+  // @@protoc_insertion_point(field_add:epoch.L2Columns.bcast_pool)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::_internal_bcast_pool() const {
+  return _impl_.bcast_pool_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::bcast_pool() const {
+  // @@protoc_insertion_point(field_list:epoch.L2Columns.bcast_pool)
+  return _internal_bcast_pool();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::_internal_mutable_bcast_pool() {
+  return &_impl_.bcast_pool_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::mutable_bcast_pool() {
+  // @@protoc_insertion_point(field_mutable_list:epoch.L2Columns.bcast_pool)
+  return _internal_mutable_bcast_pool();
+}
+
+// repeated uint32 bcast_ipv4 = 9;
+inline int L2Columns::_internal_bcast_ipv4_size() const {
+  return _impl_.bcast_ipv4_.size();
+}
+inline int L2Columns::bcast_ipv4_size() const {
+  return _internal_bcast_ipv4_size();
+}
+inline void L2Columns::clear_bcast_ipv4() {
+  _impl_.bcast_ipv4_.Clear();
+}
+inline uint32_t L2Columns::_internal_bcast_ipv4(int index) const {
+  return _impl_.bcast_ipv4_.Get(index);
+}
+inline uint32_t L2Columns::bcast_ipv4(int index) const {
+  // @@protoc_insertion_point(field_get:epoch.L2Columns.bcast_ipv4)
+  return _internal_bcast_ipv4(index);
+}
+inline void L2Columns::set_bcast_ipv4(int index, uint32_t value) {
+  _impl_.bcast_ipv4_.Set(index, value);
+  // @@protoc_insertion_point(field_set:epoch.L2Columns.bcast_ipv4)
+}
+inline void L2Columns::_internal_add_bcast_ipv4(uint32_t value) {
+  _impl_.bcast_ipv4_.Add(value);
+}
+inline void L2Columns::add_bcast_ipv4(uint32_t value) {
+  _internal_add_bcast_ipv4(value);
+  // @@protoc_insertion_point(field_add:epoch.L2Columns.bcast_ipv4)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::_internal_bcast_ipv4() const {
+  return _impl_.bcast_ipv4_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::bcast_ipv4() const {
+  // @@protoc_insertion_point(field_list:epoch.L2Columns.bcast_ipv4)
+  return _internal_bcast_ipv4();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::_internal_mutable_bcast_ipv4() {
+  return &_impl_.bcast_ipv4_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::mutable_bcast_ipv4() {
+  // @@protoc_insertion_point(field_mutable_list:epoch.L2Columns.bcast_ipv4)
+  return _internal_mutable_bcast_ipv4();
+}
+
+// repeated uint32 bcast_ipv6 = 10;
+inline int L2Columns::_internal_bcast_ipv6_size() const {
+  return _impl_.bcast_ipv6_.size();
+}
+inline int L2Columns::bcast_ipv6_size() const {
+  return _internal_bcast_ipv6_size();
+}
+inline void L2Columns::clear_bcast_ipv6() {
+  _impl_.bcast_ipv6_.Clear();
+}
+inline uint32_t L2Columns::_internal_bcast_ipv6(int index) const {
+  return _impl_.bcast_ipv6_.Get(index);
+}
+inline uint32_t L2Columns::bcast_ipv6(int index) const {
+  // @@protoc_insertion_point(field_get:epoch.L2Columns.bcast_ipv6)
+  return _internal_bcast_ipv6(index);
+}
+inline void L2Columns::set_bcast_ipv6(int index, uint32_t value) {
+  _impl_.bcast_ipv6_.Set(index, value);
+  // @@protoc_insertion_point(field_set:epoch.L2Columns.bcast_ipv6)
+}
+inline void L2Columns::_internal_add_bcast_ipv6(uint32_t value) {
+  _impl_.bcast_ipv6_.Add(value);
+}
+inline void L2Columns::add_bcast_ipv6(uint32_t value) {
+  _internal_add_bcast_ipv6(value);
+  // @@protoc_insertion_point(field_add:epoch.L2Columns.bcast_ipv6)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::_internal_bcast_ipv6() const {
+  return _impl_.bcast_ipv6_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::bcast_ipv6() const {
+  // @@protoc_insertion_point(field_list:epoch.L2Columns.bcast_ipv6)
+  return _internal_bcast_ipv6();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::_internal_mutable_bcast_ipv6() {
+  return &_impl_.bcast_ipv6_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::mutable_bcast_ipv6() {
+  // @@protoc_insertion_point(field_mutable_list:epoch.L2Columns.bcast_ipv6)
+  return _internal_mutable_bcast_ipv6();
+}
+
+// repeated uint32 bcast_arp = 11;
+inline int L2Columns::_internal_bcast_arp_size() const {
+  return _impl_.bcast_arp_.size();
+}
+inline int L2Columns::bcast_arp_size() const {
+  return _internal_bcast_arp_size();
+}
+inline void L2Columns::clear_bcast_arp() {
+  _impl_.bcast_arp_.Clear();
+}
+inline uint32_t L2Columns::_internal_bcast_arp(int index) const {
+  return _impl_.bcast_arp_.Get(index);
+}
+inline uint32_t L2Columns::bcast_arp(int index) const {
+  // @@protoc_insertion_point(field_get:epoch.L2Columns.bcast_arp)
+  return _internal_bcast_arp(index);
+}
+inline void L2Columns::set_bcast_arp(int index, uint32_t value) {
+  _impl_.bcast_arp_.Set(index, value);
+  // @@protoc_insertion_point(field_set:epoch.L2Columns.bcast_arp)
+}
+inline void L2Columns::_internal_add_bcast_arp(uint32_t value) {
+  _impl_.bcast_arp_.Add(value);
+}
+inline void L2Columns::add_bcast_arp(uint32_t value) {
+  _internal_add_bcast_arp(value);
+  // @@protoc_insertion_point(field_add:epoch.L2Columns.bcast_arp)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::_internal_bcast_arp() const {
+  return _impl_.bcast_arp_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::bcast_arp() const {
+  // @@protoc_insertion_point(field_list:epoch.L2Columns.bcast_arp)
+  return _internal_bcast_arp();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::_internal_mutable_bcast_arp() {
+  return &_impl_.bcast_arp_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::mutable_bcast_arp() {
+  // @@protoc_insertion_point(field_mutable_list:epoch.L2Columns.bcast_arp)
+  return _internal_mutable_bcast_arp();
+}
+
+// repeated uint32 bcast_unknown = 12;
+inline int L2Columns::_internal_bcast_unknown_size() const {
+  return _impl_.bcast_unknown_.size();
+}
+inline int L2Columns::bcast_unknown_size() const {
+  return _internal_bcast_unknown_size();
+}
+inline void L2Columns::clear_bcast_unknown() {
+  _impl_.bcast_unknown_.Clear();
+}
+inline uint32_t L2Columns::_internal_bcast_unknown(int index) const {
+  return _impl_.bcast_unknown_.Get(index);
+}
+inline uint32_t L2Columns::bcast_unknown(int index) const {
+  // @@protoc_insertion_point(field_get:epoch.L2Columns.bcast_unknown)
+  return _internal_bcast_unknown(index);
+}
+inline void L2Columns::set_bcast_unknown(int index, uint32_t value) {
+  _impl_.bcast_unknown_.Set(index, value);
+  // @@protoc_insertion_point(field_set:epoch.L2Columns.bcast_unknown)
+}
+inline void L2Columns::_internal_add_bcast_unknown(uint32_t value) {
+  _impl_.bcast_unknown_.Add(value);
+}
+inline void L2Columns::add_bcast_unknown(uint32_t value) {
+  _internal_add_bcast_unknown(value);
+  // @@protoc_insertion_point(field_add:epoch.L2Columns.bcast_unknown)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::_internal_bcast_unknown() const {
+  return _impl_.bcast_unknown_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+L2Columns::bcast_unknown() const {
+  // @@protoc_insertion_point(field_list:epoch.L2Columns.bcast_unknown)
+  return _internal_bcast_unknown();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::_internal_mutable_bcast_unknown() {
+  return &_impl_.bcast_unknown_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+L2Columns::mutable_bcast_unknown() {
+  // @@protoc_insertion_point(field_mutable_list:epoch.L2Columns.bcast_unknown)
+  return _internal_mutable_bcast_unknown();
 }
 
 // -------------------------------------------------------------------
@@ -1547,46 +2793,46 @@ ArpAssoc::table_row() const {
 
 // repeated fixed64 enter_l2devices = 1;
 inline int EpochStep::_internal_enter_l2devices_size() const {
-  return enter_l2devices_.size();
+  return _impl_.enter_l2devices_.size();
 }
 inline int EpochStep::enter_l2devices_size() const {
   return _internal_enter_l2devices_size();
 }
 inline void EpochStep::clear_enter_l2devices() {
-  enter_l2devices_.Clear();
+  _impl_.enter_l2devices_.Clear();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 EpochStep::_internal_enter_l2devices(int index) const {
-  return enter_l2devices_.Get(index);
+inline uint64_t EpochStep::_internal_enter_l2devices(int index) const {
+  return _impl_.enter_l2devices_.Get(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 EpochStep::enter_l2devices(int index) const {
+inline uint64_t EpochStep::enter_l2devices(int index) const {
   // @@protoc_insertion_point(field_get:epoch.EpochStep.enter_l2devices)
   return _internal_enter_l2devices(index);
 }
-inline void EpochStep::set_enter_l2devices(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  enter_l2devices_.Set(index, value);
+inline void EpochStep::set_enter_l2devices(int index, uint64_t value) {
+  _impl_.enter_l2devices_.Set(index, value);
   // @@protoc_insertion_point(field_set:epoch.EpochStep.enter_l2devices)
 }
-inline void EpochStep::_internal_add_enter_l2devices(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  enter_l2devices_.Add(value);
+inline void EpochStep::_internal_add_enter_l2devices(uint64_t value) {
+  _impl_.enter_l2devices_.Add(value);
 }
-inline void EpochStep::add_enter_l2devices(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void EpochStep::add_enter_l2devices(uint64_t value) {
   _internal_add_enter_l2devices(value);
   // @@protoc_insertion_point(field_add:epoch.EpochStep.enter_l2devices)
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
 EpochStep::_internal_enter_l2devices() const {
-  return enter_l2devices_;
+  return _impl_.enter_l2devices_;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
 EpochStep::enter_l2devices() const {
   // @@protoc_insertion_point(field_list:epoch.EpochStep.enter_l2devices)
   return _internal_enter_l2devices();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
 EpochStep::_internal_mutable_enter_l2devices() {
-  return &enter_l2devices_;
+  return &_impl_.enter_l2devices_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
 EpochStep::mutable_enter_l2devices() {
   // @@protoc_insertion_point(field_mutable_list:epoch.EpochStep.enter_l2devices)
   return _internal_mutable_enter_l2devices();
@@ -1594,119 +2840,329 @@ EpochStep::mutable_enter_l2devices() {
 
 // repeated .epoch.DeviceComm l2_dev_comm = 2;
 inline int EpochStep::_internal_l2_dev_comm_size() const {
-  return l2_dev_comm_.size();
+  return _impl_.l2_dev_comm_.size();
 }
 inline int EpochStep::l2_dev_comm_size() const {
   return _internal_l2_dev_comm_size();
 }
 inline void EpochStep::clear_l2_dev_comm() {
-  l2_dev_comm_.Clear();
+  _impl_.l2_dev_comm_.Clear();
 }
 inline ::epoch::DeviceComm* EpochStep::mutable_l2_dev_comm(int index) {
   // @@protoc_insertion_point(field_mutable:epoch.EpochStep.l2_dev_comm)
-  return l2_dev_comm_.Mutable(index);
+  return _impl_.l2_dev_comm_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::epoch::DeviceComm >*
 EpochStep::mutable_l2_dev_comm() {
   // @@protoc_insertion_point(field_mutable_list:epoch.EpochStep.l2_dev_comm)
-  return &l2_dev_comm_;
+  return &_impl_.l2_dev_comm_;
 }
 inline const ::epoch::DeviceComm& EpochStep::_internal_l2_dev_comm(int index) const {
-  return l2_dev_comm_.Get(index);
+  return _impl_.l2_dev_comm_.Get(index);
 }
 inline const ::epoch::DeviceComm& EpochStep::l2_dev_comm(int index) const {
   // @@protoc_insertion_point(field_get:epoch.EpochStep.l2_dev_comm)
   return _internal_l2_dev_comm(index);
 }
 inline ::epoch::DeviceComm* EpochStep::_internal_add_l2_dev_comm() {
-  return l2_dev_comm_.Add();
+  return _impl_.l2_dev_comm_.Add();
 }
 inline ::epoch::DeviceComm* EpochStep::add_l2_dev_comm() {
+  ::epoch::DeviceComm* _add = _internal_add_l2_dev_comm();
   // @@protoc_insertion_point(field_add:epoch.EpochStep.l2_dev_comm)
-  return _internal_add_l2_dev_comm();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::epoch::DeviceComm >&
 EpochStep::l2_dev_comm() const {
   // @@protoc_insertion_point(field_list:epoch.EpochStep.l2_dev_comm)
-  return l2_dev_comm_;
+  return _impl_.l2_dev_comm_;
 }
 
 // repeated .epoch.AddrAssoc enter_l2_ipv4_addr_src = 3;
 inline int EpochStep::_internal_enter_l2_ipv4_addr_src_size() const {
-  return enter_l2_ipv4_addr_src_.size();
+  return _impl_.enter_l2_ipv4_addr_src_.size();
 }
 inline int EpochStep::enter_l2_ipv4_addr_src_size() const {
   return _internal_enter_l2_ipv4_addr_src_size();
 }
 inline void EpochStep::clear_enter_l2_ipv4_addr_src() {
-  enter_l2_ipv4_addr_src_.Clear();
+  _impl_.enter_l2_ipv4_addr_src_.Clear();
 }
 inline ::epoch::AddrAssoc* EpochStep::mutable_enter_l2_ipv4_addr_src(int index) {
   // @@protoc_insertion_point(field_mutable:epoch.EpochStep.enter_l2_ipv4_addr_src)
-  return enter_l2_ipv4_addr_src_.Mutable(index);
+  return _impl_.enter_l2_ipv4_addr_src_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::epoch::AddrAssoc >*
 EpochStep::mutable_enter_l2_ipv4_addr_src() {
   // @@protoc_insertion_point(field_mutable_list:epoch.EpochStep.enter_l2_ipv4_addr_src)
-  return &enter_l2_ipv4_addr_src_;
+  return &_impl_.enter_l2_ipv4_addr_src_;
 }
 inline const ::epoch::AddrAssoc& EpochStep::_internal_enter_l2_ipv4_addr_src(int index) const {
-  return enter_l2_ipv4_addr_src_.Get(index);
+  return _impl_.enter_l2_ipv4_addr_src_.Get(index);
 }
 inline const ::epoch::AddrAssoc& EpochStep::enter_l2_ipv4_addr_src(int index) const {
   // @@protoc_insertion_point(field_get:epoch.EpochStep.enter_l2_ipv4_addr_src)
   return _internal_enter_l2_ipv4_addr_src(index);
 }
 inline ::epoch::AddrAssoc* EpochStep::_internal_add_enter_l2_ipv4_addr_src() {
-  return enter_l2_ipv4_addr_src_.Add();
+  return _impl_.enter_l2_ipv4_addr_src_.Add();
 }
 inline ::epoch::AddrAssoc* EpochStep::add_enter_l2_ipv4_addr_src() {
+  ::epoch::AddrAssoc* _add = _internal_add_enter_l2_ipv4_addr_src();
   // @@protoc_insertion_point(field_add:epoch.EpochStep.enter_l2_ipv4_addr_src)
-  return _internal_add_enter_l2_ipv4_addr_src();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::epoch::AddrAssoc >&
 EpochStep::enter_l2_ipv4_addr_src() const {
   // @@protoc_insertion_point(field_list:epoch.EpochStep.enter_l2_ipv4_addr_src)
-  return enter_l2_ipv4_addr_src_;
+  return _impl_.enter_l2_ipv4_addr_src_;
 }
 
 // repeated .epoch.ArpAssoc enter_arp_table = 4;
 inline int EpochStep::_internal_enter_arp_table_size() const {
-  return enter_arp_table_.size();
+  return _impl_.enter_arp_table_.size();
 }
 inline int EpochStep::enter_arp_table_size() const {
   return _internal_enter_arp_table_size();
 }
 inline void EpochStep::clear_enter_arp_table() {
-  enter_arp_table_.Clear();
+  _impl_.enter_arp_table_.Clear();
 }
 inline ::epoch::ArpAssoc* EpochStep::mutable_enter_arp_table(int index) {
   // @@protoc_insertion_point(field_mutable:epoch.EpochStep.enter_arp_table)
-  return enter_arp_table_.Mutable(index);
+  return _impl_.enter_arp_table_.Mutable(index);
 }
 inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::epoch::ArpAssoc >*
 EpochStep::mutable_enter_arp_table() {
   // @@protoc_insertion_point(field_mutable_list:epoch.EpochStep.enter_arp_table)
-  return &enter_arp_table_;
+  return &_impl_.enter_arp_table_;
 }
 inline const ::epoch::ArpAssoc& EpochStep::_internal_enter_arp_table(int index) const {
-  return enter_arp_table_.Get(index);
+  return _impl_.enter_arp_table_.Get(index);
 }
 inline const ::epoch::ArpAssoc& EpochStep::enter_arp_table(int index) const {
   // @@protoc_insertion_point(field_get:epoch.EpochStep.enter_arp_table)
   return _internal_enter_arp_table(index);
 }
 inline ::epoch::ArpAssoc* EpochStep::_internal_add_enter_arp_table() {
-  return enter_arp_table_.Add();
+  return _impl_.enter_arp_table_.Add();
 }
 inline ::epoch::ArpAssoc* EpochStep::add_enter_arp_table() {
+  ::epoch::ArpAssoc* _add = _internal_add_enter_arp_table();
   // @@protoc_insertion_point(field_add:epoch.EpochStep.enter_arp_table)
-  return _internal_add_enter_arp_table();
+  return _add;
 }
 inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::epoch::ArpAssoc >&
 EpochStep::enter_arp_table() const {
   // @@protoc_insertion_point(field_list:epoch.EpochStep.enter_arp_table)
-  return enter_arp_table_;
+  return _impl_.enter_arp_table_;
+}
+
+// string sensor = 5;
+inline void EpochStep::clear_sensor() {
+  _impl_.sensor_.ClearToEmpty();
+}
+inline const std::string& EpochStep::sensor() const {
+  // @@protoc_insertion_point(field_get:epoch.EpochStep.sensor)
+  return _internal_sensor();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EpochStep::set_sensor(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.sensor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:epoch.EpochStep.sensor)
+}
+inline std::string* EpochStep::mutable_sensor() {
+  std::string* _s = _internal_mutable_sensor();
+  // @@protoc_insertion_point(field_mutable:epoch.EpochStep.sensor)
+  return _s;
+}
+inline const std::string& EpochStep::_internal_sensor() const {
+  return _impl_.sensor_.Get();
+}
+inline void EpochStep::_internal_set_sensor(const std::string& value) {
+  
+  _impl_.sensor_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EpochStep::_internal_mutable_sensor() {
+  
+  return _impl_.sensor_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EpochStep::release_sensor() {
+  // @@protoc_insertion_point(field_release:epoch.EpochStep.sensor)
+  return _impl_.sensor_.Release();
+}
+inline void EpochStep::set_allocated_sensor(std::string* sensor) {
+  if (sensor != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.sensor_.SetAllocated(sensor, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sensor_.IsDefault()) {
+    _impl_.sensor_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:epoch.EpochStep.sensor)
+}
+
+// .epoch.RateEncoding encoding = 6;
+inline void EpochStep::clear_encoding() {
+  _impl_.encoding_ = 0;
+}
+inline ::epoch::RateEncoding EpochStep::_internal_encoding() const {
+  return static_cast< ::epoch::RateEncoding >(_impl_.encoding_);
+}
+inline ::epoch::RateEncoding EpochStep::encoding() const {
+  // @@protoc_insertion_point(field_get:epoch.EpochStep.encoding)
+  return _internal_encoding();
+}
+inline void EpochStep::_internal_set_encoding(::epoch::RateEncoding value) {
+  
+  _impl_.encoding_ = value;
+}
+inline void EpochStep::set_encoding(::epoch::RateEncoding value) {
+  _internal_set_encoding(value);
+  // @@protoc_insertion_point(field_set:epoch.EpochStep.encoding)
+}
+
+// repeated uint32 enter_l2device_ids = 7;
+inline int EpochStep::_internal_enter_l2device_ids_size() const {
+  return _impl_.enter_l2device_ids_.size();
+}
+inline int EpochStep::enter_l2device_ids_size() const {
+  return _internal_enter_l2device_ids_size();
+}
+inline void EpochStep::clear_enter_l2device_ids() {
+  _impl_.enter_l2device_ids_.Clear();
+}
+inline uint32_t EpochStep::_internal_enter_l2device_ids(int index) const {
+  return _impl_.enter_l2device_ids_.Get(index);
+}
+inline uint32_t EpochStep::enter_l2device_ids(int index) const {
+  // @@protoc_insertion_point(field_get:epoch.EpochStep.enter_l2device_ids)
+  return _internal_enter_l2device_ids(index);
+}
+inline void EpochStep::set_enter_l2device_ids(int index, uint32_t value) {
+  _impl_.enter_l2device_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:epoch.EpochStep.enter_l2device_ids)
+}
+inline void EpochStep::_internal_add_enter_l2device_ids(uint32_t value) {
+  _impl_.enter_l2device_ids_.Add(value);
+}
+inline void EpochStep::add_enter_l2device_ids(uint32_t value) {
+  _internal_add_enter_l2device_ids(value);
+  // @@protoc_insertion_point(field_add:epoch.EpochStep.enter_l2device_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+EpochStep::_internal_enter_l2device_ids() const {
+  return _impl_.enter_l2device_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+EpochStep::enter_l2device_ids() const {
+  // @@protoc_insertion_point(field_list:epoch.EpochStep.enter_l2device_ids)
+  return _internal_enter_l2device_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+EpochStep::_internal_mutable_enter_l2device_ids() {
+  return &_impl_.enter_l2device_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+EpochStep::mutable_enter_l2device_ids() {
+  // @@protoc_insertion_point(field_mutable_list:epoch.EpochStep.enter_l2device_ids)
+  return _internal_mutable_enter_l2device_ids();
+}
+
+// .epoch.L2Columns l2_columns = 8;
+inline bool EpochStep::_internal_has_l2_columns() const {
+  return this != internal_default_instance() && _impl_.l2_columns_ != nullptr;
+}
+inline bool EpochStep::has_l2_columns() const {
+  return _internal_has_l2_columns();
+}
+inline void EpochStep::clear_l2_columns() {
+  if (GetArenaForAllocation() == nullptr && _impl_.l2_columns_ != nullptr) {
+    delete _impl_.l2_columns_;
+  }
+  _impl_.l2_columns_ = nullptr;
+}
+inline const ::epoch::L2Columns& EpochStep::_internal_l2_columns() const {
+  const ::epoch::L2Columns* p = _impl_.l2_columns_;
+  return p != nullptr ? *p : reinterpret_cast<const ::epoch::L2Columns&>(
+      ::epoch::_L2Columns_default_instance_);
+}
+inline const ::epoch::L2Columns& EpochStep::l2_columns() const {
+  // @@protoc_insertion_point(field_get:epoch.EpochStep.l2_columns)
+  return _internal_l2_columns();
+}
+inline void EpochStep::unsafe_arena_set_allocated_l2_columns(
+    ::epoch::L2Columns* l2_columns) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.l2_columns_);
+  }
+  _impl_.l2_columns_ = l2_columns;
+  if (l2_columns) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:epoch.EpochStep.l2_columns)
+}
+inline ::epoch::L2Columns* EpochStep::release_l2_columns() {
+  
+  ::epoch::L2Columns* temp = _impl_.l2_columns_;
+  _impl_.l2_columns_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::epoch::L2Columns* EpochStep::unsafe_arena_release_l2_columns() {
+  // @@protoc_insertion_point(field_release:epoch.EpochStep.l2_columns)
+  
+  ::epoch::L2Columns* temp = _impl_.l2_columns_;
+  _impl_.l2_columns_ = nullptr;
+  return temp;
+}
+inline ::epoch::L2Columns* EpochStep::_internal_mutable_l2_columns() {
+  
+  if (_impl_.l2_columns_ == nullptr) {
+    auto* p = CreateMaybeMessage<::epoch::L2Columns>(GetArenaForAllocation());
+    _impl_.l2_columns_ = p;
+  }
+  return _impl_.l2_columns_;
+}
+inline ::epoch::L2Columns* EpochStep::mutable_l2_columns() {
+  ::epoch::L2Columns* _msg = _internal_mutable_l2_columns();
+  // @@protoc_insertion_point(field_mutable:epoch.EpochStep.l2_columns)
+  return _msg;
+}
+inline void EpochStep::set_allocated_l2_columns(::epoch::L2Columns* l2_columns) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.l2_columns_;
+  }
+  if (l2_columns) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(l2_columns);
+    if (message_arena != submessage_arena) {
+      l2_columns = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, l2_columns, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.l2_columns_ = l2_columns;
+  // @@protoc_insertion_point(field_set_allocated:epoch.EpochStep.l2_columns)
 }
 
 #ifdef __GNUC__
@@ -1720,11 +3176,19 @@ EpochStep::enter_arp_table() const {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace epoch
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::epoch::RateEncoding> : ::std::true_type {};
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
@@ -0,0 +1,166 @@
+#ifndef _INCL_EPOCH_MERGE
+#define _INCL_EPOCH_MERGE
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "device_key.hpp"
+#include "epoch.pb.hpp"
+
+/*
+ * Folds consecutive epochs into one aggregate epoch.
+ *
+ * Packet counts are summed per (mac_src, mac_dst) pair and per broadcast
+ * pool while the enter_* announcements are unioned. The output describes
+ * the same traffic as the inputs with one row per pair. The sensor is kept
+ * only when every input came from the same one. Devices are told apart by
+ * their device_key so rows with ids and rows with macs both merge.
+ */
+class epoch_merger {
+public:
+    void add(const epoch::EpochStep &step) {
+        if (m_steps == 0) {
+            m_sensor = step.sensor();
+        } else if (m_sensor != step.sensor()) {
+            m_sensor.clear();
+        }
+        m_steps++;
+
+        bool ids = step.enter_l2device_ids_size() == step.enter_l2devices_size();
+        for (int i = 0; i < step.enter_l2devices_size(); i++) {
+            m_devices[step.enter_l2devices(i)] = ids ? step.enter_l2device_ids(i) : 0;
+        }
+
+        for (int i = 0; i < step.l2_dev_comm_size(); i++) {
+            const epoch::DeviceComm &dComm = step.l2_dev_comm(i);
+            comm &c = m_comm[device_key::src(dComm)];
+
+            for (int j = 0; j < dComm.tx_summary_size(); j++) {
+                const epoch::L2Summary &l2sum = dComm.tx_summary(j);
+                c.tx[device_key::dst(l2sum)].add(l2sum);
+            }
+
+            if (dComm.has_bcast_33()) c.bcast[0].add(dComm.bcast_33());
+            if (dComm.has_bcast_ff()) c.bcast[1].add(dComm.bcast_ff());
+            if (dComm.has_bcast_01()) c.bcast[2].add(dComm.bcast_01());
+            if (dComm.has_bcast_xx()) c.bcast[3].add(dComm.bcast_xx());
+        }
+
+        for (int i = 0; i < step.enter_l2_ipv4_addr_src_size(); i++) {
+            const epoch::AddrAssoc &addr = step.enter_l2_ipv4_addr_src(i);
+            m_addrs[device_key::of(addr)] = addr.ipv4();
+        }
+
+        for (int i = 0; i < step.enter_arp_table_size(); i++) {
+            const epoch::ArpAssoc &arp = step.enter_arp_table(i);
+            std::map<uint64_t, uint32_t> &rows = m_arp[arp.mac_src()];
+            for (int j = 0; j < arp.table_row_size(); j++) {
+                rows[device_key::of(arp.table_row(j))] = arp.table_row(j).ipv4();
+            }
+        }
+    }
+
+    /*
+     * Writes the aggregate into out and resets the merger.
+     */
+    void write(epoch::EpochStep *out) {
+        out->set_sensor(m_sensor);
+
+        bool ids = true;
+        for (auto it = m_devices.begin(); it != m_devices.end(); it++) {
+            out->add_enter_l2devices(it->first);
+            ids = ids && it->second != 0;
+        }
+        if (ids) {
+            for (auto it = m_devices.begin(); it != m_devices.end(); it++) {
+                out->add_enter_l2device_ids(it->second);
+            }
+        }
+
+        for (auto it = m_comm.begin(); it != m_comm.end(); it++) {
+            epoch::DeviceComm *dev_comm = out->add_l2_dev_comm();
+            device_key::set_src(dev_comm, it->first);
+
+            comm &c = it->second;
+            for (auto it2 = c.tx.begin(); it2 != c.tx.end(); it2++) {
+                epoch::L2Summary *l2sum = dev_comm->add_tx_summary();
+                device_key::set_dst(l2sum, it2->first);
+                it2->second.write(l2sum);
+            }
+
+            if (c.bcast[0].seen) c.bcast[0].write(dev_comm->mutable_bcast_33());
+            if (c.bcast[1].seen) c.bcast[1].write(dev_comm->mutable_bcast_ff());
+            if (c.bcast[2].seen) c.bcast[2].write(dev_comm->mutable_bcast_01());
+            if (c.bcast[3].seen) c.bcast[3].write(dev_comm->mutable_bcast_xx());
+        }
+
+        for (auto it = m_addrs.begin(); it != m_addrs.end(); it++) {
+            epoch::AddrAssoc *addr = out->add_enter_l2_ipv4_addr_src();
+            device_key::set(addr, it->first);
+            addr->set_ipv4(it->second);
+        }
+
+        for (auto it = m_arp.begin(); it != m_arp.end(); it++) {
+            epoch::ArpAssoc *arp = out->add_enter_arp_table();
+            arp->set_mac_src(it->first);
+            for (auto it2 = it->second.begin(); it2 != it->second.end(); it2++) {
+                epoch::AddrAssoc *row = arp->add_table_row();
+                device_key::set(row, it2->first);
+                row->set_ipv4(it2->second);
+            }
+        }
+
+        clear();
+    }
+
+    void clear() {
+        m_steps = 0;
+        m_sensor.clear();
+        m_devices.clear();
+        m_comm.clear();
+        m_addrs.clear();
+        m_arp.clear();
+    }
+
+private:
+    struct counts {
+        bool seen{false};
+        uint32_t ipv4{0};
+        uint32_t ipv6{0};
+        uint32_t arp{0};
+        uint32_t unknown{0};
+
+        void add(const epoch::L2Summary &l2sum) {
+            seen = true;
+            ipv4 += l2sum.ipv4();
+            ipv6 += l2sum.ipv6();
+            arp += l2sum.arp();
+            unknown += l2sum.unknown();
+        }
+
+        void write(epoch::L2Summary *l2sum) const {
+            l2sum->set_ipv4(ipv4);
+            l2sum->set_ipv6(ipv6);
+            l2sum->set_arp(arp);
+            l2sum->set_unknown(unknown);
+        }
+    };
+
+    struct comm {
+        std::map<uint64_t, counts> tx;
+        // Indexed like the Zeek record: 33, ff, 01 then odd
+        counts bcast[4];
+    };
+
+    int m_steps{0};
+    std::string m_sensor;
+
+    // mac to id, 0 when the device came without one
+    std::map<uint64_t, uint32_t> m_devices;
+    std::map<uint64_t, comm> m_comm;
+    std::map<uint64_t, uint32_t> m_addrs;
+    std::map<uint64_t, std::map<uint64_t, uint32_t>> m_arp;
+};
+
+#endif
@@ -0,0 +1,69 @@
+#ifndef _INCL_FANOUT_RING
+#define _INCL_FANOUT_RING
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/*
+ * A fixed size ring of published values with a single writer and many
+ * readers. Readers are cursors (sequence numbers) that all live on the same
+ * consumer thread. The consumer reports the oldest cursor it still needs
+ * through release() so the writer never overwrites a slot that is being read.
+ *
+ * publish() never blocks: when the slowest cursor is a full ring behind the
+ * writer the new value is refused and the caller decides what to count.
+ */
+template <typename T, std::size_t N>
+class fanout_ring {
+public:
+    static_assert((N & (N - 1)) == 0, "fanout_ring capacity must be a power of two");
+
+    fanout_ring() : m_head(0), m_tail(0) {}
+
+    // Producer side
+    bool publish(T v) {
+        uint64_t h = m_head.load(std::memory_order_relaxed);
+        if (h - m_tail.load(std::memory_order_acquire) >= N) {
+            return false;
+        }
+        m_slots[h & (N - 1)] = std::move(v);
+        m_head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side
+    uint64_t head() const {
+        return m_head.load(std::memory_order_acquire);
+    }
+
+    uint64_t tail() const {
+        return m_tail.load(std::memory_order_relaxed);
+    }
+
+    /*
+     * Only valid for tail() <= seq < head().
+     */
+    const T& at(uint64_t seq) const {
+        return m_slots[seq & (N - 1)];
+    }
+
+    /*
+     * Marks every slot before seq as free for the producer.
+     */
+    void release(uint64_t seq) {
+        m_tail.store(seq, std::memory_order_release);
+    }
+
+    static constexpr std::size_t capacity() { return N; }
+
+private:
+    std::array<T, N> m_slots;
+
+    // Kept on separate cache lines, one is written by each thread.
+    alignas(64) std::atomic<uint64_t> m_head;
+    alignas(64) std::atomic<uint64_t> m_tail;
+};
+
+#endif
@@ -1,106 +1,81 @@
-#ifndef _INCL_PARSER
-#define _INCL_PARSER
-
-#include "broker/broker.hh"
-#include "broker/message.hh"
-#include "broker/zeek.hh"
-
-#include "epoch.pb.hpp"
-
-// directly from https://stackoverflow.com/a/7326381
-uint64_t string_to_mac(std::string const& s) {
-    unsigned char a[6];
-    int last = -1;
-    int rc = sscanf(s.c_str(), "%hhx:%hhx:%hhx:%hhx:%hhx:%hhx%n",
-                    a + 0, a + 1, a + 2, a + 3, a + 4, a + 5,
-                    &last);
-    if(rc != 6 || s.size() != last) {
-        std::cerr << "Bad MAC" << std::endl;
-        std::cout << s << std::endl;
-        return 0;
-    }
-    return
-        uint64_t(a[5]) << 40 |
-        uint64_t(a[4]) << 32 | (
-            // 32-bit instructions take fewer bytes on x86, so use them as much as possible.
-            uint32_t(a[3]) << 24 |
-            uint32_t(a[2]) << 16 |
-            uint32_t(a[1]) << 8 |
-            uint32_t(a[0])
-        );
-}
+#include <iostream>
+
+#include "input_parser.hpp"
 
-uint32_t addr_to_ip(caf::ipv6_address::array_type addr) {
+uint32_t addr_to_ip(caf::ipv6_address::array_type const& addr) {
     uint32_t ip = (
-    addr.at(15) << 24 |
-    addr.at(14) << 16 |
-    addr.at(13) << 8 |
-    addr.at(12)
+    uint32_t(addr[15]) << 24 |
+    uint32_t(addr[14]) << 16 |
+    uint32_t(addr[13]) << 8 |
+    uint32_t(addr[12])
     );
     return ip;
 }
 
-class BrokerCtx {
-    public:
-        std::chrono::duration<int64_t, std::nano> curr_pkt_lag;
-
-        int tot_pkt_drop{0};
-        int tot_epoch_drop{0};
-        int event_cnt{0};
-
-        int inv_sample_rate{1};
-        int epoch_packets_sum{0};
-
-        BrokerCtx() {};
-
-        epoch::EpochStep parse_epoch_step(broker::zeek::Event event);
-
-        int parse_l2_summary(epoch::L2Summary* es_l2sum, broker::vector* l2summary);
-        void parse_single_mcast(epoch::DeviceComm* dev_comm, int pos, std::string v, broker::vector *dComm);
-        void parse_bcast_summaries(epoch::DeviceComm* dev_comm, broker::vector *dComm);
-        void parse_enter_l3_addr(epoch::EpochStep* step, std::map<broker::data, broker::data> *addr_map);
-        void parse_arp_table(epoch::EpochStep* step, std::map<broker::data, broker::data> *arp_table);
+/*
+ * Id of the device with this mac, 0 without a registry or for a bad mac.
+ */
+uint32_t BrokerCtx::device_id(uint64_t mac) {
+    if (registry == nullptr || mac == 0) {
+        return 0;
+    }
 
-        void parse_stats_update(broker::zeek::Event event);
-};
+    auto search = id_cache.find(mac);
+    if (search != id_cache.end()) {
+        return search->second;
+    }
 
-epoch::EpochStep BrokerCtx::parse_epoch_step(broker::zeek::Event event) {
-    epoch::EpochStep step = epoch::EpochStep();
+    uint32_t id = registry->id(mac);
+    id_cache.insert(std::make_pair(mac, id));
+    return id;
+}
 
-    broker::vector parent_content = event.args();
+/*
+ * Fills step, which must be empty, from a Zeek epoch event. Nothing is
+ * copied out of the event so the caller has to keep it alive meanwhile.
+ *
+ * The server uses encode_epoch_step instead, this is the reference
+ * test/encoder_test holds the encoder to.
+ */
+void BrokerCtx::parse_epoch_step(broker::zeek::Event &event, epoch::EpochStep *step) {
+    broker::vector &parent_content = event.args();
 
     broker::vector *wrapper = broker::get_if<broker::vector>(parent_content.at(0));
     if (wrapper == nullptr) {
         std::cerr << "wrapper" << std::endl;
-        return step;
+        return;
     }
 
     broker::set *enter_l2_devices = broker::get_if<broker::set>(wrapper->at(0));
     if (enter_l2_devices == nullptr) {
         std::cerr << "enter_l2_devices" << std::endl;
-        return step;
+        return;
     }
 
     for (auto it = enter_l2_devices->begin(); it != enter_l2_devices->end(); it++) {
         auto *mac_src = broker::get_if<std::string>(*it);
         if (mac_src == nullptr) {
             std::cerr << "mac_src e_l2_dev" << std::endl;
-            return step;
+            return;
         }
 
-        step.add_enter_l2devices(string_to_mac(*mac_src));
+        uint64_t mac = string_to_mac(*mac_src);
+        step->add_enter_l2devices(mac);
+        if (registry != nullptr) {
+            step->add_enter_l2device_ids(device_id(mac));
+        }
     }
 
     std::map<broker::data, broker::data> *l2_dev_comm = broker::get_if<broker::table>(wrapper->at(1));
     if (l2_dev_comm == nullptr) {
         std::cerr << "l2_dev_comm" << std::endl;
-        return step;
+        return;
     }
 
     int pkt_tot = 0;
 
     for (auto it2 = l2_dev_comm->begin(); it2 != l2_dev_comm->end(); it2++) {
-        auto pair = *it2;
+        auto &pair = *it2;
 
         auto *mac_src = broker::get_if<std::string>(pair.first);
         if (mac_src == nullptr) {
@@ -114,8 +89,14 @@ epoch::EpochStep BrokerCtx::parse_epoch_step(broker::zeek::Event event) {
             continue;
         }
 
-        epoch::DeviceComm *dev_comm = step.add_l2_dev_comm();
-        dev_comm->set_mac_src(string_to_mac(*mac_src));
+        epoch::DeviceComm *dev_comm = step->add_l2_dev_comm();
+        uint64_t mac = string_to_mac(*mac_src);
+        uint32_t id = device_id(mac);
+        if (id) {
+            dev_comm->set_src_id(id);
+        } else {
+            dev_comm->set_mac_src(mac);
+        }
 
         std::map<broker::data, broker::data> *tx_summary = broker::get_if<broker::table>(dComm->at(1));
         if (tx_summary == nullptr) {
@@ -124,7 +105,7 @@ epoch::EpochStep BrokerCtx::parse_epoch_step(broker::zeek::Event event) {
         }
 
         for (auto it3 = tx_summary->begin(); it3 != tx_summary->end(); it3++) {
-            auto comm_pair = *it3;
+            auto &comm_pair = *it3;
             auto *mac_dst = broker::get_if<std::string>(comm_pair.first);
             if (mac_dst == nullptr) {
                 std::cerr << "mac_dst tx_summary:" << mac_src << std::endl;
@@ -132,7 +113,13 @@ epoch::EpochStep BrokerCtx::parse_epoch_step(broker::zeek::Event event) {
             }
 
             epoch::L2Summary *tx_summary = dev_comm->add_tx_summary();
-            tx_summary->set_mac_dst(string_to_mac(*mac_dst));
+            uint64_t dst = string_to_mac(*mac_dst);
+            uint32_t dst_id = device_id(dst);
+            if (dst_id) {
+                tx_summary->set_dst_id(dst_id);
+            } else {
+                tx_summary->set_mac_dst(dst);
+            }
 
             auto *l2summary = broker::get_if<broker::vector>(comm_pair.second);
             if (l2summary == nullptr) {
@@ -151,19 +138,19 @@ epoch::EpochStep BrokerCtx::parse_epoch_step(broker::zeek::Event event) {
     std::map<broker::data, broker::data> *enter_l2_ipv4_addr_src = broker::get_if<broker::table>(wrapper->at(2));
     if (enter_l2_ipv4_addr_src == nullptr) {
         std::cerr << "l2_ipv4_addr_src" << std::endl;
-        return step;
+        return;
     }
 
-    parse_enter_l3_addr(&step, enter_l2_ipv4_addr_src);
+    parse_enter_l3_addr(step, enter_l2_ipv4_addr_src);
 
     std::map<broker::data, broker::data> *enter_arp_table = broker::get_if<broker::table>(wrapper->at(3));
-    if (enter_l2_ipv4_addr_src == nullptr) {
+    if (enter_arp_table == nullptr) {
         std::cerr << "enter_arp_table" << std::endl;
-        return step;
+        return;
     }
-    parse_arp_table(&step, enter_arp_table);
+    parse_arp_table(step, enter_arp_table);
 
-    return step;
+    return;
 }
 
 
@@ -194,44 +181,43 @@ void BrokerCtx::parse_bcast_summaries(epoch::DeviceComm* dev_comm, broker::vecto
 }
 
 
-int BrokerCtx::parse_l2_summary(epoch::L2Summary* es_l2sum, broker::vector* l2summary) {
-    int sum = 0;
-    auto *ipv4_cnt = broker::get_if<broker::count>(l2summary->at(0));
-    if (ipv4_cnt == nullptr) {
-        std::cerr << "ipv4_cnt" << std::endl;
-        return 0;
-    }
-    es_l2sum->set_ipv4(*ipv4_cnt);
+static const char *l2_count_names[4] = {"ipv4_cnt", "ipv6_cnt", "arp_cnt", "unknown_cnt"};
 
-    auto *ipv6_cnt = broker::get_if<broker::count>(l2summary->at(1));
-    if (ipv6_cnt == nullptr) {
-        std::cerr << "ipv6_cnt" << std::endl;
-        return 0;
+/*
+ * Reads the ipv4, ipv6, arp and unknown counts of a Zeek L2Summary in order
+ * and stops at the first one that is missing. Returns how many were read.
+ */
+static int read_l2_counts(broker::vector* l2summary, broker::count counts[4]) {
+    for (int i = 0; i < 4; i++) {
+        auto *cnt = broker::get_if<broker::count>(l2summary->at(i));
+        if (cnt == nullptr) {
+            std::cerr << l2_count_names[i] << std::endl;
+            return i;
+        }
+        counts[i] = *cnt;
     }
-    es_l2sum->set_ipv6(*ipv6_cnt);
+    return 4;
+}
 
-    auto *arp_cnt = broker::get_if<broker::count>(l2summary->at(2));
-    if (arp_cnt == nullptr) {
-        std::cerr << "arp_cnt" << std::endl;
-        return 0;
-    }
-    es_l2sum->set_arp(*arp_cnt);
+int BrokerCtx::parse_l2_summary(epoch::L2Summary* es_l2sum, broker::vector* l2summary) {
+    broker::count cnt[4];
+    int n = read_l2_counts(l2summary, cnt);
+
+    if (n > 0) es_l2sum->set_ipv4(cnt[0]);
+    if (n > 1) es_l2sum->set_ipv6(cnt[1]);
+    if (n > 2) es_l2sum->set_arp(cnt[2]);
+    if (n > 3) es_l2sum->set_unknown(cnt[3]);
 
-    auto *unknown_cnt = broker::get_if<broker::count>(l2summary->at(3));
-    if (unknown_cnt == nullptr) {
-        std::cerr << "unknown_cnt" << std::endl;
+    if (n < 4) {
         return 0;
     }
-    es_l2sum->set_unknown(*unknown_cnt);
-
-    sum = *ipv4_cnt + *ipv6_cnt + *arp_cnt + *unknown_cnt;
-    return sum;
+    return cnt[0] + cnt[1] + cnt[2] + cnt[3];
 }
 
 
 void BrokerCtx::parse_enter_l3_addr(epoch::EpochStep *step, std::map<broker::data, broker::data> *addr_map) {
      for (auto it = addr_map->begin(); it != addr_map->end(); it++) {
-        auto pair = *it;
+        auto &pair = *it;
         auto *mac_src = broker::get_if<std::string>(pair.first);
         if (mac_src == nullptr) {
             std::cerr << "mac_src l2_ipv4_addr:" << std::endl;
@@ -239,7 +225,13 @@ void BrokerCtx::parse_enter_l3_addr(epoch::EpochStep *step, std::map<broker::dat
         }
 
         epoch::AddrAssoc *addr_assoc = step->add_enter_l2_ipv4_addr_src();
-        addr_assoc->set_mac_src(string_to_mac(*mac_src));
+        uint64_t mac = string_to_mac(*mac_src);
+        uint32_t id = device_id(mac);
+        if (id) {
+            addr_assoc->set_id(id);
+        } else {
+            addr_assoc->set_mac_src(mac);
+        }
 
         auto *ip_addr_src = broker::get_if<broker::address>(pair.second);
         if (ip_addr_src == nullptr) {
@@ -255,7 +247,7 @@ void BrokerCtx::parse_enter_l3_addr(epoch::EpochStep *step, std::map<broker::dat
 
 void BrokerCtx::parse_arp_table(epoch::EpochStep *step, std::map<broker::data, broker::data> *arp_table) {
     for (auto it = arp_table->begin(); it != arp_table->end(); it++) {
-        auto pair = *it;
+        auto &pair = *it;
         auto *mac_src = broker::get_if<std::string>(pair.first);
         if (mac_src == nullptr) {
             std::cerr << "mac_src arp_table:" << std::endl;
@@ -272,7 +264,7 @@ void BrokerCtx::parse_arp_table(epoch::EpochStep *step, std::map<broker::data, b
         arp_assoc->set_mac_src(string_to_mac(*mac_src));
 
         for (auto it2 = src_table->begin(); it2 != src_table->end(); it2++) {
-            auto pair2 = *it2;
+            auto &pair2 = *it2;
             auto *mac_dst = broker::get_if<std::string>(pair2.first);
             if (mac_dst == nullptr) {
                 std::cerr << "mac_dst arp_table:" << std::endl;
@@ -287,9 +279,371 @@ void BrokerCtx::parse_arp_table(epoch::EpochStep *step, std::map<broker::data, b
 
             epoch::AddrAssoc *addr_assoc = arp_assoc->add_table_row();
             addr_assoc->set_ipv4(addr_to_ip(ip_addr_dst->bytes()));
-            addr_assoc->set_mac_src(string_to_mac(*mac_dst));
+            uint64_t row_mac = string_to_mac(*mac_dst);
+            uint32_t row_id = device_id(row_mac);
+            if (row_id) {
+                addr_assoc->set_id(row_id);
+            } else {
+                addr_assoc->set_mac_src(row_mac);
+            }
+        }
+    }
+}
+
+
+/*
+ * Protobuf wire format helpers for the encoder below. Every field number in
+ * epoch.proto is under 16 so tags fit in one byte. Like proto3 itself the
+ * encoder leaves out scalars that are zero.
+ */
+enum wire_type {
+    WIRE_VARINT = 0,
+    WIRE_FIXED64 = 1,
+    WIRE_LEN = 2,
+    WIRE_FIXED32 = 5
+};
+
+static size_t varint_size(uint64_t v) {
+    size_t n = 1;
+    while (v >= 0x80) {
+        v >>= 7;
+        n++;
+    }
+    return n;
+}
+
+static void put_varint(std::string *out, uint64_t v) {
+    while (v >= 0x80) {
+        out->push_back(char(v | 0x80));
+        v >>= 7;
+    }
+    out->push_back(char(v));
+}
+
+static void put_tag(std::string *out, int field, wire_type type) {
+    out->push_back(char(field << 3 | type));
+}
+
+static void put_fixed64(std::string *out, uint64_t v) {
+    char b[8];
+    for (int i = 0; i < 8; i++) {
+        b[i] = char(v >> (8 * i));
+    }
+    out->append(b, 8);
+}
+
+static void put_fixed32(std::string *out, uint32_t v) {
+    char b[4];
+    for (int i = 0; i < 4; i++) {
+        b[i] = char(v >> (8 * i));
+    }
+    out->append(b, 4);
+}
+
+static void put_bytes(std::string *out, int field, std::string const& bytes) {
+    put_tag(out, field, WIRE_LEN);
+    put_varint(out, bytes.size());
+    out->append(bytes);
+}
+
+// Writes an L2Summary holding the first n of the four counts
+static void put_l2_summary(std::string *out, int field, uint64_t mac_dst, uint32_t dst_id,
+                           const broker::count *cnt, int n) {
+    size_t size = mac_dst ? 9 : 0;
+    for (int i = 0; i < n; i++) {
+        uint32_t v = uint32_t(cnt[i]);
+        if (v) size += 1 + varint_size(v);
+    }
+    if (dst_id) size += 1 + varint_size(dst_id);
+
+    put_tag(out, field, WIRE_LEN);
+    put_varint(out, size);
+    if (mac_dst) {
+        put_tag(out, 1, WIRE_FIXED64);
+        put_fixed64(out, mac_dst);
+    }
+    for (int i = 0; i < n; i++) {
+        uint32_t v = uint32_t(cnt[i]);
+        if (v) {
+            put_tag(out, i + 2, WIRE_VARINT);
+            put_varint(out, v);
+        }
+    }
+    if (dst_id) {
+        put_tag(out, 6, WIRE_VARINT);
+        put_varint(out, dst_id);
+    }
+}
+
+static void put_addr_assoc(std::string *out, int field, uint64_t mac, uint32_t id, uint32_t ipv4) {
+    put_tag(out, field, WIRE_LEN);
+    put_varint(out, (mac ? 9 : 0) + (ipv4 ? 5 : 0) + (id ? 1 + varint_size(id) : 0));
+    if (mac) {
+        put_tag(out, 1, WIRE_FIXED64);
+        put_fixed64(out, mac);
+    }
+    if (ipv4) {
+        put_tag(out, 2, WIRE_FIXED32);
+        put_fixed32(out, ipv4);
+    }
+    if (id) {
+        put_tag(out, 3, WIRE_VARINT);
+        put_varint(out, id);
+    }
+}
+
+/*
+ * Appends the epoch to out as a serialized EpochStep without building one.
+ * The bytes are exactly what serializing the result of parse_epoch_step with
+ * the sensor set would give, malformed input included.
+ */
+void BrokerCtx::encode_epoch_step(broker::zeek::Event &event, std::string const& sensor, std::string *out) {
+    size_t start = out->size();
+    out->reserve(start + last_epoch_size);
+    delta.clear();
+    enter_ids.clear();
+
+    encode_epoch_body(event, out);
+
+    if (!sensor.empty()) {
+        put_bytes(out, 5, sensor);
+    }
+
+    // enter_l2device_ids is packed
+    if (!enter_ids.empty()) {
+        size_t size = 0;
+        for (uint32_t id : enter_ids) {
+            size += varint_size(id);
+        }
+        put_tag(out, 7, WIRE_LEN);
+        put_varint(out, size);
+        for (uint32_t id : enter_ids) {
+            put_varint(out, id);
+        }
+    }
+
+    last_epoch_size = out->size() - start;
+}
+
+void BrokerCtx::encode_epoch_body(broker::zeek::Event &event, std::string *out) {
+    broker::vector &parent_content = event.args();
+
+    broker::vector *wrapper = broker::get_if<broker::vector>(parent_content.at(0));
+    if (wrapper == nullptr) {
+        std::cerr << "wrapper" << std::endl;
+        return;
+    }
+
+    broker::set *enter_l2_devices = broker::get_if<broker::set>(wrapper->at(0));
+    if (enter_l2_devices == nullptr) {
+        std::cerr << "enter_l2_devices" << std::endl;
+        return;
+    }
+
+    bool complete = true;
+    for (auto it = enter_l2_devices->begin(); it != enter_l2_devices->end(); it++) {
+        auto *mac_src = broker::get_if<std::string>(*it);
+        if (mac_src == nullptr) {
+            std::cerr << "mac_src e_l2_dev" << std::endl;
+            complete = false;
+            break;
+        }
+        uint64_t mac = string_to_mac(*mac_src);
+        delta.devices.push_back(mac);
+        if (registry != nullptr) {
+            enter_ids.push_back(device_id(mac));
+        }
+    }
+
+    // enter_l2devices is packed
+    if (!delta.devices.empty()) {
+        put_tag(out, 1, WIRE_LEN);
+        put_varint(out, 8 * delta.devices.size());
+        for (uint64_t mac : delta.devices) {
+            put_fixed64(out, mac);
+        }
+    }
+    if (!complete) {
+        return;
+    }
+
+    std::map<broker::data, broker::data> *l2_dev_comm = broker::get_if<broker::table>(wrapper->at(1));
+    if (l2_dev_comm == nullptr) {
+        std::cerr << "l2_dev_comm" << std::endl;
+        return;
+    }
+
+    for (auto it2 = l2_dev_comm->begin(); it2 != l2_dev_comm->end(); it2++) {
+        auto &pair = *it2;
+
+        auto *mac_src = broker::get_if<std::string>(pair.first);
+        if (mac_src == nullptr) {
+            std::cerr << "mac_src e_l2_dev" << std::endl;
+            continue;
+        }
+
+        auto *dComm = broker::get_if<broker::vector>(pair.second);
+        if (dComm == nullptr) {
+            std::cerr << "dComm" <<  std::endl;
+            continue;
+        }
+
+        encode_dev_comm(out, string_to_mac(*mac_src), dComm);
+    }
+
+    std::map<broker::data, broker::data> *enter_l2_ipv4_addr_src = broker::get_if<broker::table>(wrapper->at(2));
+    if (enter_l2_ipv4_addr_src == nullptr) {
+        std::cerr << "l2_ipv4_addr_src" << std::endl;
+        return;
+    }
+    encode_enter_l3_addr(out, enter_l2_ipv4_addr_src);
+
+    std::map<broker::data, broker::data> *enter_arp_table = broker::get_if<broker::table>(wrapper->at(3));
+    if (enter_arp_table == nullptr) {
+        std::cerr << "enter_arp_table" << std::endl;
+        return;
+    }
+    encode_arp_table(out, enter_arp_table);
+}
+
+
+void BrokerCtx::encode_dev_comm(std::string *out, uint64_t mac_src, broker::vector *dComm) {
+    std::string &buf = dev_comm_buf;
+    buf.clear();
+
+    uint32_t src_id = device_id(mac_src);
+    if (mac_src && !src_id) {
+        put_tag(&buf, 1, WIRE_FIXED64);
+        put_fixed64(&buf, mac_src);
+    }
+
+    std::map<broker::data, broker::data> *tx_summary = broker::get_if<broker::table>(dComm->at(1));
+    if (tx_summary == nullptr) {
+        std::cerr << "tx_summary" <<  std::endl;
+    } else {
+        encode_tx_summary(&buf, tx_summary, dComm);
+    }
+
+    if (src_id) {
+        put_tag(&buf, 7, WIRE_VARINT);
+        put_varint(&buf, src_id);
+    }
+
+    put_bytes(out, 2, buf);
+}
+
+
+void BrokerCtx::encode_tx_summary(std::string *buf, std::map<broker::data, broker::data> *tx_summary, broker::vector *dComm) {
+    for (auto it3 = tx_summary->begin(); it3 != tx_summary->end(); it3++) {
+        auto &comm_pair = *it3;
+        auto *mac_dst = broker::get_if<std::string>(comm_pair.first);
+        if (mac_dst == nullptr) {
+            std::cerr << "mac_dst tx_summary" << std::endl;
+            continue;
+        }
+
+        broker::count cnt[4];
+        int n = 0;
+
+        auto *l2summary = broker::get_if<broker::vector>(comm_pair.second);
+        if (l2summary == nullptr) {
+            std::cerr << "l2summary" << std::endl;
+        } else {
+            n = read_l2_counts(l2summary, cnt);
+        }
+
+        uint64_t dst = string_to_mac(*mac_dst);
+        uint32_t dst_id = device_id(dst);
+        put_l2_summary(buf, 2, dst_id ? 0 : dst, dst_id, cnt, n);
+    }
+
+    // Fields 3 to 6 are the 33, ff, 01 and odd pools which sit at these
+    // positions in the Zeek record
+    static const int bcast_pos[4] = {3, 2, 4, 5};
+    for (int i = 0; i < 4; i++) {
+        auto *bcast_val = broker::get_if<broker::vector>(dComm->at(bcast_pos[i]));
+        if (bcast_val == nullptr) {
+            continue;
         }
+
+        broker::count cnt[4];
+        int n = read_l2_counts(bcast_val, cnt);
+        put_l2_summary(buf, 3 + i, 0, 0, cnt, n);
     }
 }
 
-#endif
\ No newline at end of file
+
+void BrokerCtx::encode_enter_l3_addr(std::string *out, std::map<broker::data, broker::data> *addr_map) {
+    for (auto it = addr_map->begin(); it != addr_map->end(); it++) {
+        auto &pair = *it;
+        auto *mac_src = broker::get_if<std::string>(pair.first);
+        if (mac_src == nullptr) {
+            std::cerr << "mac_src l2_ipv4_addr:" << std::endl;
+            continue;
+        }
+
+        uint64_t mac = string_to_mac(*mac_src);
+        uint32_t ipv4 = 0;
+        auto *ip_addr_src = broker::get_if<broker::address>(pair.second);
+        if (ip_addr_src == nullptr) {
+            std::cerr << "ip_addr_src l2_ipv4_addr:" << *mac_src << std::endl;
+        } else {
+            ipv4 = addr_to_ip(ip_addr_src->bytes());
+            delta.addrs.push_back(std::make_pair(mac, ipv4));
+        }
+
+        uint32_t id = device_id(mac);
+        put_addr_assoc(out, 3, id ? 0 : mac, id, ipv4);
+    }
+}
+
+
+void BrokerCtx::encode_arp_table(std::string *out, std::map<broker::data, broker::data> *arp_table) {
+    for (auto it = arp_table->begin(); it != arp_table->end(); it++) {
+        auto &pair = *it;
+        auto *mac_src = broker::get_if<std::string>(pair.first);
+        if (mac_src == nullptr) {
+            std::cerr << "mac_src arp_table:" << std::endl;
+            continue;
+        }
+
+        std::map<broker::data, broker::data> *src_table = broker::get_if<broker::table>(pair.second);
+        if (src_table == nullptr) {
+            std::cerr << "src_table arp_table:" << *mac_src << std::endl;
+            continue;
+        }
+
+        std::string &buf = arp_buf;
+        buf.clear();
+
+        uint64_t mac = string_to_mac(*mac_src);
+        if (mac) {
+            put_tag(&buf, 1, WIRE_FIXED64);
+            put_fixed64(&buf, mac);
+        }
+
+        for (auto it2 = src_table->begin(); it2 != src_table->end(); it2++) {
+            auto &pair2 = *it2;
+            auto *mac_dst = broker::get_if<std::string>(pair2.first);
+            if (mac_dst == nullptr) {
+                std::cerr << "mac_dst arp_table:" << std::endl;
+                continue;
+            }
+
+            auto *ip_addr_dst = broker::get_if<broker::address>(pair2.second);
+            if (ip_addr_dst == nullptr) {
+                std::cerr << "ip_addr_dst arp_table:" << *mac_dst << std::endl;
+                continue;
+            }
+
+            uint64_t row_mac = string_to_mac(*mac_dst);
+            uint32_t row_ipv4 = addr_to_ip(ip_addr_dst->bytes());
+            delta.arp.push_back(std::make_tuple(mac, row_mac, row_ipv4));
+
+            uint32_t row_id = device_id(row_mac);
+            put_addr_assoc(&buf, 2, row_id ? 0 : row_mac, row_id, row_ipv4);
+        }
+
+        put_bytes(out, 4, buf);
+    }
+}
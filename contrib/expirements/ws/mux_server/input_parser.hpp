@@ -0,0 +1,114 @@
+#ifndef _INCL_PARSER
+#define _INCL_PARSER
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "broker/broker.hh"
+#include "broker/message.hh"
+#include "broker/zeek.hh"
+
+#include "epoch.pb.hpp"
+#include "mac_decode.hpp"
+
+uint32_t addr_to_ip(caf::ipv6_address::array_type const& addr);
+
+/*
+ * What one epoch adds to the device, address and arp tables.
+ */
+struct table_delta {
+    std::vector<uint64_t> devices;
+    // mac, ipv4
+    std::vector<std::pair<uint64_t, uint32_t>> addrs;
+    // mac of the arp table owner, mac of the row, ipv4 of the row
+    std::vector<std::tuple<uint64_t, uint64_t, uint32_t>> arp;
+
+    void clear() {
+        devices.clear();
+        addrs.clear();
+        arp.clear();
+    }
+};
+
+/*
+ * Dense device ids handed out in the order devices are first seen. Ids
+ * start at 1 so 0 always means a row names its device by mac.
+ */
+class device_registry {
+    public:
+        uint32_t id(uint64_t mac) {
+            std::lock_guard<std::mutex> guard(m_lock);
+            auto search = m_ids.find(mac);
+            if (search != m_ids.end()) {
+                return search->second;
+            }
+            uint32_t id = uint32_t(m_ids.size()) + 1;
+            m_ids.insert(std::make_pair(mac, id));
+            return id;
+        }
+
+    private:
+        std::mutex m_lock;
+        std::unordered_map<uint64_t, uint32_t> m_ids;
+};
+
+class BrokerCtx {
+    public:
+        std::chrono::duration<int64_t, std::nano> curr_pkt_lag;
+
+        int tot_pkt_drop{0};
+        int tot_epoch_drop{0};
+        int event_cnt{0};
+
+        int inv_sample_rate{1};
+        int epoch_packets_sum{0};
+
+        // Filled by encode_epoch_step for the last epoch it encoded
+        table_delta delta;
+
+        // Where device ids come from, without one every row carries macs
+        device_registry *registry{nullptr};
+
+        BrokerCtx() {};
+
+        uint32_t device_id(uint64_t mac);
+
+        void parse_epoch_step(broker::zeek::Event &event, epoch::EpochStep *step);
+        void encode_epoch_step(broker::zeek::Event &event, std::string const& sensor, std::string *out);
+
+        int parse_l2_summary(epoch::L2Summary* es_l2sum, broker::vector* l2summary);
+        void parse_single_mcast(epoch::DeviceComm* dev_comm, int pos, std::string v, broker::vector *dComm);
+        void parse_bcast_summaries(epoch::DeviceComm* dev_comm, broker::vector *dComm);
+        void parse_enter_l3_addr(epoch::EpochStep* step, std::map<broker::data, broker::data> *addr_map);
+        void parse_arp_table(epoch::EpochStep* step, std::map<broker::data, broker::data> *arp_table);
+
+        void parse_stats_update(broker::zeek::Event event);
+
+    private:
+        void encode_epoch_body(broker::zeek::Event &event, std::string *out);
+        void encode_dev_comm(std::string *out, uint64_t mac_src, broker::vector *dComm);
+        void encode_tx_summary(std::string *buf, std::map<broker::data, broker::data> *tx_summary, broker::vector *dComm);
+        void encode_enter_l3_addr(std::string *out, std::map<broker::data, broker::data> *addr_map);
+        void encode_arp_table(std::string *out, std::map<broker::data, broker::data> *arp_table);
+
+        // Nested messages are written here first to learn their length
+        std::string dev_comm_buf;
+        std::string arp_buf;
+
+        // Ids of delta.devices
+        std::vector<uint32_t> enter_ids;
+
+        // Ids this thread already looked up in the registry
+        std::unordered_map<uint64_t, uint32_t> id_cache;
+
+        size_t last_epoch_size{0};
+};
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef _INCL_L2_COLUMNS
+#define _INCL_L2_COLUMNS
+
+#include "epoch.pb.hpp"
+
+/*
+ * Copies in to out with every l2_dev_comm row that names its devices by id
+ * moved into the parallel arrays of l2_columns. Rows still naming a device
+ * by mac stay in l2_dev_comm.
+ */
+inline void write_columns(const epoch::EpochStep &in, epoch::EpochStep *out) {
+    out->CopyFrom(in);
+    out->clear_l2_dev_comm();
+
+    epoch::L2Columns *cols = out->mutable_l2_columns();
+
+    for (int i = 0; i < in.l2_dev_comm_size(); i++) {
+        const epoch::DeviceComm &dComm = in.l2_dev_comm(i);
+        if (dComm.src_id() == 0) {
+            *out->add_l2_dev_comm() = dComm;
+            continue;
+        }
+
+        epoch::DeviceComm *rest = nullptr;
+        for (int j = 0; j < dComm.tx_summary_size(); j++) {
+            const epoch::L2Summary &l2sum = dComm.tx_summary(j);
+            if (l2sum.dst_id() == 0) {
+                if (rest == nullptr) {
+                    rest = out->add_l2_dev_comm();
+                    rest->set_src_id(dComm.src_id());
+                }
+                *rest->add_tx_summary() = l2sum;
+                continue;
+            }
+
+            cols->add_src_id(dComm.src_id());
+            cols->add_dst_id(l2sum.dst_id());
+            cols->add_ipv4(l2sum.ipv4());
+            cols->add_ipv6(l2sum.ipv6());
+            cols->add_arp(l2sum.arp());
+            cols->add_unknown(l2sum.unknown());
+        }
+
+        const epoch::L2Summary *pools[4] = {
+            dComm.has_bcast_33() ? &dComm.bcast_33() : nullptr,
+            dComm.has_bcast_ff() ? &dComm.bcast_ff() : nullptr,
+            dComm.has_bcast_01() ? &dComm.bcast_01() : nullptr,
+            dComm.has_bcast_xx() ? &dComm.bcast_xx() : nullptr,
+        };
+        for (int p = 0; p < 4; p++) {
+            if (pools[p] == nullptr) {
+                continue;
+            }
+            cols->add_bcast_src_id(dComm.src_id());
+            cols->add_bcast_pool(p);
+            cols->add_bcast_ipv4(pools[p]->ipv4());
+            cols->add_bcast_ipv6(pools[p]->ipv6());
+            cols->add_bcast_arp(pools[p]->arp());
+            cols->add_bcast_unknown(pools[p]->unknown());
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef _INCL_MAC_DECODE
+#define _INCL_MAC_DECODE
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+/*
+ * Kept apart from input_parser so bench/ can time it without broker.
+ */
+
+/*
+ * Value of each ascii hex digit, -1 for every other byte. A table rather
+ * than range tests: mac digits are random, so the tests mispredict.
+ */
+struct hex_table {
+    int8_t v[256];
+    hex_table() {
+        for (int c = 0; c < 256; c++) v[c] = -1;
+        for (int c = 0; c < 10; c++) v['0' + c] = c;
+        for (int c = 0; c < 6; c++) v['a' + c] = v['A' + c] = 10 + c;
+    }
+};
+
+inline int hex_val(unsigned char c) {
+    static const hex_table table;
+    return table.v[c];
+}
+
+/*
+ * Decodes a mac in the form Zeek prints them: six pairs of hex digits joined
+ * by colons. The first octet ends up in the lowest byte.
+ */
+inline uint64_t string_to_mac(std::string const& s) {
+    if (s.size() != 17) {
+        std::cerr << "Bad MAC: " << s << std::endl;
+        return 0;
+    }
+
+    const char *p = s.data();
+    uint64_t mac = 0;
+    for (int i = 0; i < 6; i++, p += 3) {
+        int hi = hex_val(p[0]);
+        int lo = hex_val(p[1]);
+        if ((hi | lo) < 0 || (i < 5 && p[2] != ':')) {
+            std::cerr << "Bad MAC: " << s << std::endl;
+            return 0;
+        }
+        mac |= uint64_t(hi << 4 | lo) << (8 * i);
+    }
+    return mac;
+}
+
+#endif
@@ -10,25 +10,83 @@
 
 #include <websocketpp/server.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <deque>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <set>
 #include <streambuf>
 #include <string>
+#include <tuple>
+#include <vector>
+
+#include <poll.h>
+#include <zlib.h>
 
 #include "broker/broker.hh"
 #include "broker/message.hh"
 #include "broker/zeek.hh"
 
 #include "epoch.pb.hpp"
+#include "epoch_merge.hpp"
+#include "fanout_ring.hpp"
+#include "input_parser.hpp"
+#include "l2_columns.hpp"
+#include "rate_delta.hpp"
+#include "step_pool.hpp"
 
-class BrokerCtx {
-public:
-    BrokerCtx() {};
-    epoch::EpochStep parse_epoch_step(broker::zeek::Event event);
+int broker_port;
+
+/*
+ * What to do with a websocket whose send buffer grows past the high water mark.
+ */
+enum class backpressure_policy {
+    // Hold new epochs and only keep the most recent max_backlog of them
+    drop_oldest,
+    // Hold new epochs and send everything held as one merged epoch later
+    coalesce,
+    // Close the connection once it stays congested for evict_after seconds
+    disconnect
 };
 
-int broker_port;
+struct mux_config {
+    backpressure_policy policy{backpressure_policy::drop_oldest};
+
+    // Bytes queued inside websocketpp for a connection before it is congested
+    size_t high_water{4*1024*1024};
+
+    // Epochs a congested connection may fall behind before the oldest are dropped
+    uint64_t max_backlog{64};
+
+    // Seconds a connection may stay congested with the disconnect policy
+    int evict_after{10};
+
+    // Longest flush interval a client may request in milliseconds
+    int max_interval{10000};
+
+    // Most broker messages handled per wakeup of the telemetry thread
+    size_t batch_size{64};
+
+    // Threads that parse epochs, 0 parses on the telemetry thread
+    unsigned workers{0};
+
+    // Epochs received but not yet parsed before the telemetry thread waits
+    size_t max_pending{64};
+
+    // Seconds between keyframes sent to clients that asked for deltas
+    int keyframe_every{10};
+
+    // Percent a pair's packet count has to move before a delta resends it
+    unsigned delta_threshold{25};
+
+    // File every epoch is appended to as it is published, for bench/
+    std::string record_path;
+};
 
 
 class mux_server {
@@ -36,9 +94,70 @@ public:
     typedef websocketpp::connection_hdl connection_hdl;
 
     typedef websocketpp::server<websocketpp::config::asio> server;
+    typedef websocketpp::config::asio::message_type message_type;
     typedef websocketpp::lib::lock_guard<websocketpp::lib::mutex> scoped_lock;
 
-    mux_server() : m_count(0) {
+    struct client_state {
+        // Sequence number of the next epoch to send from m_ring
+        uint64_t cursor;
+
+        bool congested;
+        bool evicted;
+        std::chrono::steady_clock::time_point congested_since;
+
+        // Milliseconds between merged epochs, 0 sends every epoch as it arrives
+        int interval;
+        int64_t last_flush;
+
+        // Sensors the client wants epochs from, empty means all of them
+        std::set<std::string> sensors;
+        std::string sensor_key;
+
+        // Set for clients that inflate every epoch they receive
+        bool deflate;
+
+        // Set for clients that decode rows from l2_columns
+        bool columnar;
+
+        // Set for clients that keep a rate table and want keyframes and deltas
+        bool delta;
+        int64_t last_keyframe;
+        rate_delta rates;
+    };
+
+    typedef std::map<std::tuple<uint64_t, uint64_t, std::string>, server::message_ptr> merge_cache;
+
+    // Devices, addresses and arp tables announced by one Zeek sensor
+    struct sensor_table {
+        uint64_t epochs{0};
+        std::set<uint64_t> devices;
+        std::map<uint64_t, uint32_t> addrs;
+        std::map<uint64_t, std::map<uint64_t, uint32_t>> arp;
+    };
+
+    struct epoch_entry {
+        server::message_ptr msg;
+        std::string sensor;
+        // Decoded from msg on the asio thread the first time a merge, a delta
+        // or a columnar rewrite needs it
+        mutable std::shared_ptr<const epoch::EpochStep> step;
+        // Built on the asio thread the first time a client needs them,
+        // deflated is indexed by columnar
+        mutable server::message_ptr columnar;
+        mutable server::message_ptr deflated[2];
+    };
+
+    typedef std::map<connection_hdl,client_state,std::owner_less<connection_hdl>> con_list;
+
+    struct parse_job {
+        uint64_t seq;
+        std::string sensor;
+        broker::zeek::Event event;
+    };
+
+    mux_server(mux_config cfg) : m_cfg(cfg),
+        m_steps(fanout_ring<epoch_entry, 256>::capacity() + cfg.max_pending),
+        m_drain_pending(false), m_count(0), m_ring_full(0) {
         // set up access channels to only log interesting things
         m_endpoint.clear_access_channels(websocketpp::log::alevel::all);
         m_endpoint.set_access_channels(websocketpp::log::alevel::access_core);
@@ -52,6 +171,14 @@ public:
         using websocketpp::lib::bind;
         m_endpoint.set_open_handler(bind(&mux_server::on_open,this,_1));
         m_endpoint.set_close_handler(bind(&mux_server::on_close,this,_1));
+
+        if (!m_cfg.record_path.empty()) {
+            m_record.open(m_cfg.record_path, std::ios::binary | std::ios::trunc);
+            if (!m_record) {
+                std::cerr << "Could not open " << m_cfg.record_path << std::endl;
+                std::exit(1);
+            }
+        }
     }
 
     void run(const uint16_t port) {
@@ -63,8 +190,17 @@ public:
         // Create a thread to run the telemetry loop
         websocketpp::lib::thread telemetry_thread(&mux_server::telemetry_loop,this);
 
+        // Create the threads that parse epochs
+        std::vector<websocketpp::lib::thread> workers;
+        for (unsigned i = 0; i < m_cfg.workers; i++) {
+            workers.emplace_back(&mux_server::parse_loop, this);
+        }
+
         asio_thread.join();
         telemetry_thread.join();
+        for (auto &w : workers) {
+            w.join();
+        }
     }
 
     void serve_sockets() {
@@ -73,6 +209,7 @@ public:
 
         // Start the server accept loop
         m_endpoint.start_accept();
+        schedule_report();
         try {
             m_endpoint.run();
         } catch (websocketpp::exception const & e) {
@@ -81,25 +218,629 @@ public:
     }
 
 
+    // on_open, on_close and drain_epochs all run on the asio thread. That
+    // thread is the only one that touches m_connections.
     void on_open(connection_hdl hdl) {
-        m_connections.insert(hdl);
+        client_state c;
+        c.congested = false;
+        c.evicted = false;
+        c.interval = 0;
+        c.last_flush = 0;
+        c.deflate = false;
+        c.columnar = false;
+        c.delta = false;
+        c.last_keyframe = 0;
+
+        // Clients pick their own cadence and sensors with the query string
+        // e.g. /?interval=1000&sensors=vlan10,vlan20&delta=1&compress=deflate
+        // or /?layout=columnar
+        websocketpp::lib::error_code ec;
+        server::connection_ptr con = m_endpoint.get_con_from_hdl(hdl, ec);
+        if (!ec) {
+            const std::string &resource = con->get_resource();
+
+            int ms = atoi(query_param(resource, "interval").c_str());
+            c.interval = std::max(0, std::min(ms, m_cfg.max_interval));
+
+            c.deflate = query_param(resource, "compress") == "deflate";
+            c.columnar = query_param(resource, "layout") == "columnar";
+            c.delta = query_param(resource, "delta") == "1";
+
+            c.sensor_key = query_param(resource, "sensors");
+            std::stringstream ss(c.sensor_key);
+            std::string sensor;
+            while (std::getline(ss, sensor, ',')) {
+                c.sensors.insert(sensor);
+            }
+        }
+
+        // Epochs only announce what is new, so a late client first gets
+        // everything announced before its cursor in one epoch
+        server::message_ptr snapshot;
+        {
+            scoped_lock guard(m_reorder_lock);
+            c.cursor = m_ring.head();
+            snapshot = make_snapshot(c);
+        }
+
+        m_connections[hdl] = c;
+
+        if (snapshot && c.deflate) {
+            snapshot = deflate_frame(snapshot);
+        }
+        if (snapshot) {
+            m_endpoint.send(hdl, snapshot, ec);
+        }
+    }
+
+    /*
+     * The caller holds m_reorder_lock so no epoch is published meanwhile.
+     */
+    server::message_ptr make_snapshot(const client_state &c) {
+        epoch::EpochStep step;
+        std::set<uint64_t> devices;
+
+        scoped_lock guard(m_lock);
+        for (auto it = m_sensors.begin(); it != m_sensors.end(); it++) {
+            if (!c.sensors.empty() && c.sensors.count(it->first) == 0) {
+                continue;
+            }
+            const sensor_table &table = it->second;
+            devices.insert(table.devices.begin(), table.devices.end());
+
+            for (auto it2 = table.addrs.begin(); it2 != table.addrs.end(); it2++) {
+                epoch::AddrAssoc *addr = step.add_enter_l2_ipv4_addr_src();
+                addr->set_mac_src(it2->first);
+                addr->set_ipv4(it2->second);
+            }
+
+            for (auto it2 = table.arp.begin(); it2 != table.arp.end(); it2++) {
+                epoch::ArpAssoc *arp = step.add_enter_arp_table();
+                arp->set_mac_src(it2->first);
+                for (auto it3 = it2->second.begin(); it3 != it2->second.end(); it3++) {
+                    epoch::AddrAssoc *row = arp->add_table_row();
+                    row->set_mac_src(it3->first);
+                    row->set_ipv4(it3->second);
+                }
+            }
+        }
+
+        if (devices.empty()) {
+            return server::message_ptr();
+        }
+        for (auto it = devices.begin(); it != devices.end(); it++) {
+            step.add_enter_l2devices(*it);
+            step.add_enter_l2device_ids(m_device_ids.id(*it));
+        }
+        if (c.sensors.size() == 1) {
+            step.set_sensor(*c.sensors.begin());
+        }
+        return make_frame(step);
+    }
+
+    static std::string query_param(const std::string &resource, const std::string &key) {
+        size_t q = resource.find('?');
+        while (q != std::string::npos) {
+            size_t start = q + 1;
+            if (resource.compare(start, key.size(), key) == 0 && resource[start + key.size()] == '=') {
+                size_t end = resource.find('&', start);
+                start += key.size() + 1;
+                return resource.substr(start, end == std::string::npos ? end : end - start);
+            }
+            q = resource.find('&', start);
+        }
+        return "";
+    }
+
+    static bool subscribed(const client_state &c, const epoch_entry &entry) {
+        return c.sensors.empty() || c.sensors.count(entry.sensor) > 0;
     }
 
     void on_close(connection_hdl hdl) {
         m_connections.erase(hdl);
+        release_ring();
+    }
+
+    /*
+     * Called from the telemetry thread after an epoch is published. At most
+     * one drain is queued on the asio thread at any time.
+     */
+    void schedule_drain() {
+        if (!m_drain_pending.exchange(true)) {
+            m_endpoint.get_io_service().post(websocketpp::lib::bind(&mux_server::drain_epochs, this));
+        }
+    }
+
+    void drain_epochs() {
+        m_drain_pending = false;
+
+        uint64_t head = m_ring.head();
+        auto now = std::chrono::steady_clock::now();
+        int64_t now_ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count();
+
+        // Clients with the same interval flush in the same pass over the same
+        // range of epochs, so each merged frame is only built once.
+        merge_cache merged;
+
+        // Earliest interval boundary a client is holding epochs for
+        int64_t next_flush = 0;
+
+        con_list::iterator it;
+        for (it = m_connections.begin(); it != m_connections.end(); ++it) {
+            client_state &c = it->second;
+            if (c.evicted) {
+                c.cursor = head;
+                continue;
+            }
+
+            websocketpp::lib::error_code ec;
+            server::connection_ptr con = m_endpoint.get_con_from_hdl(it->first, ec);
+            if (ec) {
+                continue;
+            }
+
+            if (con->get_buffered_amount() > m_cfg.high_water) {
+                if (!c.congested) {
+                    c.congested = true;
+                    c.congested_since = now;
+                }
+                hold_epochs(it->first, c, head, now);
+                continue;
+            }
+
+            if (c.interval > 0) {
+                // Flushes happen on the first drain after each interval
+                // boundary so they trail the boundary by at most one tick.
+                int64_t bucket = now_ms / c.interval;
+                bool full = head - c.cursor >= m_ring.capacity()/2;
+                if (c.cursor == head) {
+                    continue;
+                }
+                if (bucket == c.last_flush && !full) {
+                    int64_t at = (bucket + 1) * c.interval;
+                    if (next_flush == 0 || at < next_flush) {
+                        next_flush = at;
+                    }
+                    continue;
+                }
+                c.last_flush = bucket;
+                c.congested = false;
+
+                server::message_ptr msg = merge_range(merged, c, head);
+                if (msg) {
+                    send_epoch(it->first, c, msg, nullptr, now_ms, ec);
+                }
+                c.cursor = head;
+                continue;
+            }
+
+            if (c.congested && m_cfg.policy == backpressure_policy::coalesce && head - c.cursor > 1) {
+                server::message_ptr msg = merge_range(merged, c, head);
+                if (msg) {
+                    send_epoch(it->first, c, msg, nullptr, now_ms, ec);
+                    m_bp_coalesced += count_subscribed(c, c.cursor, head) - 1;
+                }
+                c.cursor = head;
+            }
+            c.congested = false;
+
+            for (; c.cursor < head; c.cursor++) {
+                const epoch_entry &entry = m_ring.at(c.cursor);
+                if (subscribed(c, entry)) {
+                    send_epoch(it->first, c, entry.msg, &entry, now_ms, ec);
+                }
+            }
+        }
+
+        if (next_flush != 0) {
+            schedule_flush(next_flush, now_ms);
+        }
+        release_ring();
+    }
+
+    /*
+     * Drains again at the next interval boundary so a client's last partial
+     * interval goes out even when no new epoch arrives to trigger a drain.
+     */
+    void schedule_flush(int64_t at, int64_t now_ms) {
+        if (m_flush_at != 0 && m_flush_at <= at) {
+            return;
+        }
+        m_flush_at = at;
+        m_flush_timer = m_endpoint.set_timer(at - now_ms, websocketpp::lib::bind(
+            &mux_server::on_flush,
+            this,
+            websocketpp::lib::placeholders::_1));
+    }
+
+    void on_flush(websocketpp::lib::error_code const & ec) {
+        if (ec) {
+            return;
+        }
+        m_flush_at = 0;
+        drain_epochs();
+    }
+
+    /*
+     * Sends msg rewritten for what the client asked for. entry is the ring
+     * entry msg came from, null for merged epochs, so the compressed frame
+     * of an epoch is built once for every client.
+     */
+    void send_epoch(connection_hdl hdl, client_state &c, server::message_ptr msg, const epoch_entry *entry,
+                    int64_t now_ms, websocketpp::lib::error_code &ec) {
+        if (c.delta) {
+            bool keyframe = c.last_keyframe == 0 || now_ms - c.last_keyframe >= m_cfg.keyframe_every * 1000;
+            if (keyframe) {
+                c.last_keyframe = now_ms;
+            }
+
+            m_rewrite_out.Clear();
+            c.rates.write(step_of(msg, entry), &m_rewrite_out, keyframe, m_cfg.delta_threshold);
+
+            msg = make_frame(m_rewrite_out);
+            entry = nullptr;
+        }
+
+        // Rate tables are kept as rows so deltas are never sent as columns
+        bool columnar = c.columnar && !c.delta;
+        if (columnar) {
+            if (entry == nullptr) {
+                msg = columnar_frame(msg, nullptr);
+            } else {
+                if (!entry->columnar) {
+                    entry->columnar = columnar_frame(msg, entry);
+                }
+                msg = entry->columnar;
+            }
+        }
+
+        if (c.deflate) {
+            m_deflate_raw += msg->get_payload().size();
+            if (entry == nullptr) {
+                msg = deflate_frame(msg);
+            } else {
+                server::message_ptr &deflated = entry->deflated[columnar];
+                if (!deflated) {
+                    deflated = deflate_frame(msg);
+                }
+                msg = deflated;
+            }
+            m_deflate_sent += msg->get_payload().size();
+        }
+
+        m_endpoint.send(hdl, msg, ec);
+    }
+
+    server::message_ptr columnar_frame(server::message_ptr msg, const epoch_entry *entry) {
+        m_rewrite_out.Clear();
+        write_columns(step_of(msg, entry), &m_rewrite_out);
+        return make_frame(m_rewrite_out);
+    }
+
+    /*
+     * The epoch msg holds. Ring entries are decoded once and shared by every
+     * client, merged epochs are parsed into m_rewrite_in each time.
+     */
+    const epoch::EpochStep& step_of(server::message_ptr msg, const epoch_entry *entry) {
+        if (entry != nullptr) {
+            return decoded(*entry);
+        }
+        m_rewrite_in.Clear();
+        m_rewrite_in.ParseFromString(msg->get_payload());
+        return m_rewrite_in;
+    }
+
+    /*
+     * zlib stream of the payload of msg, or msg itself if zlib fails.
+     */
+    static server::message_ptr deflate_frame(server::message_ptr msg) {
+        const std::string &payload = msg->get_payload();
+
+        server::message_ptr out = make_message();
+        std::string &buf = out->get_raw_payload();
+
+        uLongf len = compressBound(payload.size());
+        buf.resize(len);
+        int res = compress2(reinterpret_cast<Bytef*>(&buf[0]), &len,
+                            reinterpret_cast<const Bytef*>(payload.data()), payload.size(),
+                            Z_DEFAULT_COMPRESSION);
+        if (res != Z_OK) {
+            std::cerr << "deflate failed: " << res << std::endl;
+            return msg;
+        }
+        buf.resize(len);
+
+        return prepare_frame(out);
+    }
+
+    /*
+     * Applies the backpressure policy to a connection that is over the high
+     * water mark. Nothing new is queued on it while it stays congested.
+     */
+    void hold_epochs(connection_hdl hdl, client_state &c, uint64_t head, std::chrono::steady_clock::time_point now) {
+        if (m_cfg.policy == backpressure_policy::disconnect &&
+            now - c.congested_since > std::chrono::seconds(m_cfg.evict_after)) {
+            websocketpp::lib::error_code ec;
+            m_endpoint.close(hdl, websocketpp::close::status::policy_violation, "slow consumer", ec);
+            c.evicted = true;
+            c.cursor = head;
+            m_bp_evicted++;
+            return;
+        }
+
+        // The coalesce policy holds as much as it can but no client may keep
+        // the producer from reusing the ring.
+        uint64_t backlog = m_ring.capacity()/2;
+        if (m_cfg.policy == backpressure_policy::drop_oldest) {
+            backlog = std::min(backlog, m_cfg.max_backlog);
+        }
+
+        if (head - c.cursor > backlog) {
+            m_bp_dropped += count_subscribed(c, c.cursor, head - backlog);
+            c.cursor = head - backlog;
+        }
+    }
+
+    /*
+     * Epochs in [first, last) of the ring the client would have received.
+     */
+    uint64_t count_subscribed(const client_state &c, uint64_t first, uint64_t last) {
+        if (c.sensors.empty()) {
+            return last - first;
+        }
+        uint64_t n = 0;
+        for (uint64_t seq = first; seq < last; seq++) {
+            n += subscribed(c, m_ring.at(seq));
+        }
+        return n;
+    }
+
+    /*
+     * Merges the epochs from the client's cursor up to last that it is
+     * subscribed to. Returns an empty pointer when none of them match.
+     */
+    server::message_ptr merge_range(merge_cache &cache, const client_state &c, uint64_t last) {
+        auto key = std::make_tuple(c.cursor, last, c.sensor_key);
+        auto search = cache.find(key);
+        if (search != cache.end()) {
+            return search->second;
+        }
+
+        server::message_ptr msg;
+        int matched = 0;
+        for (uint64_t seq = c.cursor; seq < last; seq++) {
+            const epoch_entry &entry = m_ring.at(seq);
+            if (subscribed(c, entry)) {
+                m_merger.add(decoded(entry));
+                msg = entry.msg;
+                matched++;
+            }
+        }
+
+        if (matched > 1) {
+            m_merged.Clear();
+            m_merger.write(&m_merged);
+            msg = make_frame(m_merged);
+        } else {
+            m_merger.clear();
+        }
+
+        cache.insert(std::make_pair(key, msg));
+        return msg;
+    }
+
+    void release_ring() {
+        uint64_t oldest = m_ring.head();
+        con_list::iterator it;
+        for (it = m_connections.begin(); it != m_connections.end(); ++it) {
+            oldest = std::min(oldest, it->second.cursor);
+        }
+        m_ring.release(oldest);
+    }
+
+    /*
+     * Serializes the step once into a complete websocket frame. Server to
+     * client frames are never masked so the same prepared message can be
+     * queued on every connection without being copied or framed again.
+     */
+    static server::message_ptr make_message() {
+        return websocketpp::lib::make_shared<message_type>(
+            message_type::con_msg_man_ptr(),
+            websocketpp::frame::opcode::binary);
+    }
+
+    static server::message_ptr make_frame(const epoch::EpochStep &step) {
+        server::message_ptr msg = make_message();
+
+        step.SerializePartialToString(&msg->get_raw_payload());
+
+        return prepare_frame(msg);
+    }
+
+    static server::message_ptr prepare_frame(server::message_ptr msg) {
+        size_t len = msg->get_payload().size();
+
+        websocketpp::frame::basic_header h(websocketpp::frame::opcode::binary, len, true, false);
+        websocketpp::frame::extended_header e(len);
+        msg->set_header(websocketpp::frame::prepare_header(h, e));
+        msg->set_prepared(true);
+
+        return msg;
+    }
+
+    void schedule_report() {
+        m_timer = m_endpoint.set_timer(10000, websocketpp::lib::bind(
+            &mux_server::on_report,
+            this,
+            websocketpp::lib::placeholders::_1));
+    }
+
+    void on_report(websocketpp::lib::error_code const & ec) {
+        if (ec) {
+            return;
+        }
+
+        uint64_t congested = 0;
+        con_list::iterator it;
+        for (it = m_connections.begin(); it != m_connections.end(); ++it) {
+            congested += it->second.congested;
+        }
+
+        std::cerr << "Clients: " << m_connections.size() << " congested: " << congested;
+        std::cerr << " dropped: " << m_bp_dropped << " coalesced: " << m_bp_coalesced;
+        std::cerr << " evicted: " << m_bp_evicted << std::endl;
+
+        if (m_deflate_raw > 0) {
+            std::cerr << "Deflate raw bytes: " << m_deflate_raw << " sent: " << m_deflate_sent;
+            std::cerr << " ratio: " << double(m_deflate_sent) / m_deflate_raw << std::endl;
+        }
+
+        // Only a count for the log, clients get the merged devices of the
+        // sensors they watch from make_snapshot
+        scoped_lock guard(m_lock);
+        std::set<uint64_t> merged;
+        for (auto s_it = m_sensors.begin(); s_it != m_sensors.end(); s_it++) {
+            const sensor_table &table = s_it->second;
+            std::cerr << "Sensor '" << s_it->first << "' epochs: " << table.epochs;
+            std::cerr << " devices: " << table.devices.size() << std::endl;
+            merged.insert(table.devices.begin(), table.devices.end());
+        }
+        std::cerr << "Devices across all sensors: " << merged.size() << std::endl;
+
+        schedule_report();
+    }
+
+    /*
+     * Topics are monopt/<kind> for a lone Zeek or monopt/<sensor>/<kind>
+     * when several sensors peer with the same mux_server.
+     */
+    static void split_topic(const std::string &name, std::string *sensor, std::string *kind) {
+        size_t first = name.find('/');
+        size_t last = name.rfind('/');
+        if (first == std::string::npos) {
+            *kind = name;
+            return;
+        }
+        if (first != last) {
+            *sensor = name.substr(first + 1, last - first - 1);
+        }
+        *kind = name.substr(last + 1);
+    }
+
+    void record_sensor(const std::string &sensor, const table_delta &delta) {
+        scoped_lock guard(m_lock);
+        sensor_table &table = m_sensors[sensor];
+        table.epochs++;
+        table.devices.insert(delta.devices.begin(), delta.devices.end());
+        for (auto it = delta.addrs.begin(); it != delta.addrs.end(); it++) {
+            table.addrs[it->first] = it->second;
+        }
+        for (auto it = delta.arp.begin(); it != delta.arp.end(); it++) {
+            table.arp[std::get<0>(*it)][std::get<1>(*it)] = std::get<2>(*it);
+        }
+    }
+
+    /*
+     * Runs on every worker thread. Epochs are parsed in any order and
+     * published in the order they arrived from broker.
+     */
+    void parse_loop() {
+        BrokerCtx bCtx = BrokerCtx();
+        bCtx.registry = &m_device_ids;
+
+        while (1) {
+            websocketpp::lib::unique_lock<websocketpp::lib::mutex> lock(m_job_lock);
+            while (m_jobs.empty()) {
+                m_job_cond.wait(lock);
+            }
+            parse_job job = std::move(m_jobs.front());
+            m_jobs.pop_front();
+            lock.unlock();
+            m_job_cond.notify_all();
+
+            epoch_entry entry = build_entry(bCtx, job);
+            complete_job(job.seq, std::move(entry), bCtx.delta);
+        }
+    }
+
+    /*
+     * Writes the epoch straight into the payload of its frame. Nothing
+     * downstream needs an EpochStep unless epochs have to be merged.
+     */
+    epoch_entry build_entry(BrokerCtx &bCtx, parse_job &job) {
+        epoch_entry entry;
+        entry.sensor = job.sensor;
+        entry.msg = make_message();
+
+        bCtx.encode_epoch_step(job.event, job.sensor, &entry.msg->get_raw_payload());
+        prepare_frame(entry.msg);
+        return entry;
+    }
+
+    const epoch::EpochStep& decoded(const epoch_entry &entry) {
+        if (!entry.step) {
+            step_pool::step_ptr step = m_steps.acquire();
+            step->ParseFromString(entry.msg->get_payload());
+            entry.step = step;
+        }
+        return *entry.step;
+    }
+
+    /*
+     * Holds finished epochs until every earlier one is done. Publishing only
+     * happens under m_reorder_lock so the ring still has a single producer,
+     * and each epoch updates the sensor tables as it is published so a
+     * snapshot taken under the same lock matches the ring head.
+     */
+    void complete_job(uint64_t seq, epoch_entry entry, const table_delta &delta) {
+        scoped_lock guard(m_reorder_lock);
+        m_reorder.insert(std::make_pair(seq, std::make_pair(std::move(entry), delta)));
+
+        auto it = m_reorder.begin();
+        while (it != m_reorder.end() && it->first == m_next_publish) {
+            record_sensor(it->second.first.sensor, it->second.second);
+            if (m_record.is_open()) {
+                record_epoch(it->second.first.msg->get_payload());
+            }
+            if (m_ring.publish(std::move(it->second.first))) {
+                schedule_drain();
+            } else {
+                m_ring_full++;
+                if (m_ring_full % 50 == 1) {
+                    std::cerr << "Epoch ring full, dropped: " << m_ring_full << std::endl;
+                }
+            }
+            m_next_publish++;
+            it = m_reorder.erase(it);
+        }
+    }
+
+    /*
+     * Appends a payload to the recording as a little endian 32 bit length
+     * followed by the bytes, the format bench/deflate_bench reads.
+     */
+    void record_epoch(const std::string &payload) {
+        uint32_t len = payload.size();
+        unsigned char prefix[4] = {
+            uint8_t(len), uint8_t(len >> 8), uint8_t(len >> 16), uint8_t(len >> 24)
+        };
+        m_record.write(reinterpret_cast<const char*>(prefix), sizeof prefix);
+        m_record.write(payload.data(), payload.size());
+        m_record.flush();
     }
 
     void telemetry_loop() {
         uint64_t count = 0;
-        std::stringstream val;
 
         std::string addr = "0.0.0.0";
         BrokerCtx bCtx = BrokerCtx();
+        bCtx.registry = &m_device_ids;
 
         // Zeek broker components
         broker::endpoint _ep;
 
-        broker::subscriber subscriber = _ep.make_subscriber({"monopt/l2", "monopt/stats"});
+        // Matches monopt/l2 and every per sensor topic like monopt/<sensor>/l2
+        broker::subscriber subscriber = _ep.make_subscriber({"monopt/"});
         broker::status_subscriber status_subscriber = _ep.make_status_subscriber(true);
 
         int res = _ep.listen(addr, broker_port);
@@ -113,28 +854,54 @@ public:
           std::cout << addr << ":" << broker_port << std::endl;
         }
 
-        int len = 1024*10;
-        char buf[len] = {0};
-
         int stats_cnt = 0;
+
+        // Sleep on the subscriber's readiness fd instead of spinning on poll()
+        pollfd pfd;
+        pfd.fd = subscriber.fd();
+        pfd.events = POLLIN;
+
         while(1) {
-            for (auto msg : subscriber.poll()) {
+            pfd.revents = 0;
+            int ready = ::poll(&pfd, 1, 1000);
+            if (ready < 0 && errno != EINTR) {
+                std::cerr << "poll failed: " << strerror(errno) << std::endl;
+                std::exit(1);
+            }
+            if (ready <= 0) {
+                continue;
+            }
+
+            size_t n = std::min(subscriber.available(), m_cfg.batch_size);
+            if (n == 0) {
+                continue;
+            }
+
+            for (auto msg : subscriber.get(n)) {
                 broker::topic topic = broker::get_topic(msg);
                 broker::zeek::Event event = broker::get_data(msg);
                 std::string name = to_string(topic);
-                if (name.compare("monopt/l2") == 0) {
-                    epoch::EpochStep step = bCtx.parse_epoch_step(event);
 
-                    val.str("");
-                    val << "Topic: " << name << " cnt:" << count++;
+                std::string sensor, kind;
+                split_topic(name, &sensor, &kind);
+
+                if (kind.compare("l2") == 0) {
+                    parse_job job{count++, sensor, std::move(event)};
 
-                    step.SerializePartialToArray(&buf, len);
+                    if (m_cfg.workers == 0) {
+                        epoch_entry entry = build_entry(bCtx, job);
+                        complete_job(job.seq, std::move(entry), bCtx.delta);
+                        continue;
+                    }
 
-                    con_list::iterator it;
-                    for (it = m_connections.begin(); it != m_connections.end(); ++it) {
-                        m_endpoint.send(*it, buf, step.ByteSize(), websocketpp::frame::opcode::binary);
+                    websocketpp::lib::unique_lock<websocketpp::lib::mutex> lock(m_job_lock);
+                    while (m_jobs.size() >= m_cfg.max_pending) {
+                        m_job_cond.wait(lock);
                     }
-                } else if (name.compare("monopt/stats") == 0) {
+                    m_jobs.push_back(std::move(job));
+                    lock.unlock();
+                    m_job_cond.notify_all();
+                } else if (kind.compare("stats") == 0) {
                     //parse_stats_update(event);
                     stats_cnt ++;
                     if (stats_cnt % 50 == 0) {
@@ -149,29 +916,86 @@ public:
     }
 
 private:
+    mux_config m_cfg;
     server m_endpoint;
     websocketpp::lib::mutex m_lock;
     bool m_open;
     bool m_done;
 
-    typedef std::set<connection_hdl,std::owner_less<connection_hdl>> con_list;
-
     con_list m_connections;
     server::timer_ptr m_timer;
 
+    // Interval flush timer and the boundary it fires at, 0 when none is set
+    server::timer_ptr m_flush_timer;
+    int64_t m_flush_at{0};
+
+    // Ids for every device any sensor announced, shared by all workers
+    device_registry m_device_ids;
+
+    // Declared before everything that holds a step so it is destroyed last
+    step_pool m_steps;
+
+    // Framed epochs waiting to be sent, written by the telemetry thread
+    fanout_ring<epoch_entry, 256> m_ring;
+    std::atomic<bool> m_drain_pending;
+
+    // Only used on the asio thread
+    epoch_merger m_merger;
+    epoch::EpochStep m_merged;
+    // Scratch for rewriting an epoch as deltas or columns
+    epoch::EpochStep m_rewrite_in;
+    epoch::EpochStep m_rewrite_out;
+
+    // Epochs waiting for a worker
+    websocketpp::lib::mutex m_job_lock;
+    websocketpp::lib::condition_variable m_job_cond;
+    std::deque<parse_job> m_jobs;
+
+    // Parsed epochs waiting for an earlier one to finish, also held while a
+    // new client takes its snapshot
+    websocketpp::lib::mutex m_reorder_lock;
+    std::map<uint64_t, std::pair<epoch_entry, table_delta>> m_reorder;
+    uint64_t m_next_publish{0};
+
+    // Guarded by m_reorder_lock
+    std::ofstream m_record;
+
+    // Guarded by m_lock
+    std::map<std::string, sensor_table> m_sensors;
+
     // Telemetry data
     uint64_t m_count;
+    uint64_t m_ring_full;
     uint16_t m_port;
+
+    // Backpressure counters, only touched on the asio thread
+    uint64_t m_bp_dropped{0};
+    uint64_t m_bp_coalesced{0};
+    uint64_t m_bp_evicted{0};
+
+    // Payload bytes before and after compression for deflate clients
+    uint64_t m_deflate_raw{0};
+    uint64_t m_deflate_sent{0};
 };
 
 int main(int argc, char* argv[]) {
-    mux_server s;
+    mux_config cfg;
 
     std::string docroot;
     uint16_t port = 9002;
 
-    if (argc == 1) {
-        std::cout << "Usage: mux_server [port] [broker-port]" << std::endl;
+    if (argc < 3) {
+        std::cout << "Usage: mux_server [port] [broker-port] [options]" << std::endl;
+        std::cout << "  --backpressure=drop|coalesce|disconnect" << std::endl;
+        std::cout << "  --high-water=<bytes>" << std::endl;
+        std::cout << "  --max-backlog=<epochs>" << std::endl;
+        std::cout << "  --evict-after=<seconds>" << std::endl;
+        std::cout << "  --max-interval=<ms>" << std::endl;
+        std::cout << "  --batch=<messages>" << std::endl;
+        std::cout << "  --workers=<threads>" << std::endl;
+        std::cout << "  --keyframe-every=<seconds>" << std::endl;
+        std::cout << "  --delta-threshold=<percent>" << std::endl;
+        std::cout << "  --record=<file>" << std::endl;
         return 1;
     }
 
@@ -193,6 +1017,45 @@ int main(int argc, char* argv[]) {
         broker_port = uint16_t(j);
     }
 
+    for (int k = 3; k < argc; k++) {
+        const char *arg = argv[k];
+        if (strcmp(arg, "--backpressure=drop") == 0) {
+            cfg.policy = backpressure_policy::drop_oldest;
+        } else if (strcmp(arg, "--backpressure=coalesce") == 0) {
+            cfg.policy = backpressure_policy::coalesce;
+        } else if (strcmp(arg, "--backpressure=disconnect") == 0) {
+            cfg.policy = backpressure_policy::disconnect;
+        } else if (strncmp(arg, "--high-water=", 13) == 0) {
+            cfg.high_water = strtoull(arg + 13, nullptr, 10);
+        } else if (strncmp(arg, "--max-backlog=", 14) == 0) {
+            cfg.max_backlog = std::max(1ull, strtoull(arg + 14, nullptr, 10));
+        } else if (strncmp(arg, "--evict-after=", 14) == 0) {
+            cfg.evict_after = atoi(arg + 14);
+        } else if (strncmp(arg, "--max-interval=", 15) == 0) {
+            cfg.max_interval = atoi(arg + 15);
+        } else if (strncmp(arg, "--batch=", 8) == 0) {
+            cfg.batch_size = std::max(1ull, strtoull(arg + 8, nullptr, 10));
+        } else if (strncmp(arg, "--workers=", 10) == 0) {
+            char *end;
+            long n = strtol(arg + 10, &end, 10);
+            if (end == arg + 10 || *end != '\0' || n <= 0 || n > 64) {
+                std::cout << "invalid worker count, expected 1 to 64" << std::endl;
+                return 1;
+            }
+            cfg.workers = unsigned(n);
+        } else if (strncmp(arg, "--keyframe-every=", 17) == 0) {
+            cfg.keyframe_every = std::max(1, atoi(arg + 17));
+        } else if (strncmp(arg, "--delta-threshold=", 18) == 0) {
+            cfg.delta_threshold = atoi(arg + 18);
+        } else if (strncmp(arg, "--record=", 9) == 0) {
+            cfg.record_path = arg + 9;
+        } else {
+            std::cout << "unknown option " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    mux_server s(cfg);
     s.run(port);
     return 0;
 }
@@ -0,0 +1,148 @@
+#ifndef _INCL_RATE_DELTA
+#define _INCL_RATE_DELTA
+
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <utility>
+
+#include "device_key.hpp"
+#include "epoch.pb.hpp"
+
+/*
+ * Tracks the per pair rate table one client holds and rewrites epochs as
+ * KEYFRAME or DELTA steps against it.
+ *
+ * A row is a (source, slot) pair where the slot is either the destination
+ * or one of the four broadcast pools. Devices are named by device_key.
+ * A DELTA step only carries rows whose packet total moved by more than
+ * threshold percent since they were last sent, plus empty rows for pairs
+ * that went quiet. Announcements pass through untouched.
+ */
+class rate_delta {
+public:
+    /*
+     * Writes in to out as a keyframe or as a delta against what was sent
+     * before, and remembers what the client now holds.
+     */
+    void write(const epoch::EpochStep &in, epoch::EpochStep *out, bool keyframe, unsigned threshold) {
+        out->set_sensor(in.sensor());
+        out->mutable_enter_l2devices()->CopyFrom(in.enter_l2devices());
+        out->mutable_enter_l2_ipv4_addr_src()->CopyFrom(in.enter_l2_ipv4_addr_src());
+        out->mutable_enter_arp_table()->CopyFrom(in.enter_arp_table());
+
+        m_curr.clear();
+        for (int i = 0; i < in.l2_dev_comm_size(); i++) {
+            const epoch::DeviceComm &dComm = in.l2_dev_comm(i);
+            uint64_t src = device_key::src(dComm);
+
+            for (int j = 0; j < dComm.tx_summary_size(); j++) {
+                const epoch::L2Summary &l2sum = dComm.tx_summary(j);
+                m_curr[std::make_pair(src, device_key::dst(l2sum))] = rate(l2sum);
+            }
+
+            if (dComm.has_bcast_33()) m_curr[std::make_pair(src, POOL_SLOT + 0)] = rate(dComm.bcast_33());
+            if (dComm.has_bcast_ff()) m_curr[std::make_pair(src, POOL_SLOT + 1)] = rate(dComm.bcast_ff());
+            if (dComm.has_bcast_01()) m_curr[std::make_pair(src, POOL_SLOT + 2)] = rate(dComm.bcast_01());
+            if (dComm.has_bcast_xx()) m_curr[std::make_pair(src, POOL_SLOT + 3)] = rate(dComm.bcast_xx());
+        }
+
+        if (keyframe) {
+            out->set_encoding(epoch::KEYFRAME);
+            m_sent.swap(m_curr);
+            for (auto it = m_sent.begin(); it != m_sent.end(); it++) {
+                add_row(out, it->first, it->second);
+            }
+            return;
+        }
+
+        // One pass over both tables in key order, so every row of a source
+        // lands in the same DeviceComm
+        out->set_encoding(epoch::DELTA);
+        auto curr = m_curr.begin();
+        auto sent = m_sent.begin();
+        while (curr != m_curr.end() || sent != m_sent.end()) {
+            if (sent == m_sent.end() || (curr != m_curr.end() && curr->first < sent->first)) {
+                m_sent.insert(sent, *curr);
+                add_row(out, curr->first, curr->second);
+                curr++;
+            } else if (curr == m_curr.end() || sent->first < curr->first) {
+                add_row(out, sent->first, rate());
+                sent = m_sent.erase(sent);
+            } else {
+                if (moved(sent->second, curr->second, threshold)) {
+                    sent->second = curr->second;
+                    add_row(out, curr->first, curr->second);
+                }
+                curr++;
+                sent++;
+            }
+        }
+    }
+
+private:
+    // Slots from here up to the id bit are broadcast pools, macs only use
+    // 48 bits
+    static constexpr uint64_t POOL_SLOT = uint64_t(1) << 48;
+
+    struct rate {
+        uint32_t ipv4{0};
+        uint32_t ipv6{0};
+        uint32_t arp{0};
+        uint32_t unknown{0};
+
+        rate() {}
+        explicit rate(const epoch::L2Summary &l2sum) :
+            ipv4(l2sum.ipv4()), ipv6(l2sum.ipv6()), arp(l2sum.arp()), unknown(l2sum.unknown()) {}
+
+        int64_t total() const {
+            return int64_t(ipv4) + ipv6 + arp + unknown;
+        }
+    };
+
+    typedef std::pair<uint64_t, uint64_t> row_key;
+
+    static bool moved(const rate &sent, const rate &curr, unsigned threshold) {
+        int64_t diff = std::llabs(curr.total() - sent.total());
+        return diff > 0 && diff * 100 >= sent.total() * int64_t(threshold);
+    }
+
+    static void write_rate(epoch::L2Summary *l2sum, const rate &r) {
+        l2sum->set_ipv4(r.ipv4);
+        l2sum->set_ipv6(r.ipv6);
+        l2sum->set_arp(r.arp);
+        l2sum->set_unknown(r.unknown);
+    }
+
+    // Consecutive rows of the same source share one DeviceComm
+    static void add_row(epoch::EpochStep *out, const row_key &key, const rate &r) {
+        int n = out->l2_dev_comm_size();
+        epoch::DeviceComm *dev_comm;
+        if (n > 0 && device_key::src(out->l2_dev_comm(n - 1)) == key.first) {
+            dev_comm = out->mutable_l2_dev_comm(n - 1);
+        } else {
+            dev_comm = out->add_l2_dev_comm();
+            device_key::set_src(dev_comm, key.first);
+        }
+
+        if (key.second < POOL_SLOT || (key.second & device_key::ID_BIT)) {
+            epoch::L2Summary *l2sum = dev_comm->add_tx_summary();
+            device_key::set_dst(l2sum, key.second);
+            write_rate(l2sum, r);
+            return;
+        }
+
+        switch (key.second - POOL_SLOT) {
+            case 0: write_rate(dev_comm->mutable_bcast_33(), r); break;
+            case 1: write_rate(dev_comm->mutable_bcast_ff(), r); break;
+            case 2: write_rate(dev_comm->mutable_bcast_01(), r); break;
+            default: write_rate(dev_comm->mutable_bcast_xx(), r); break;
+        }
+    }
+
+    // What the client holds and what the current epoch holds
+    std::map<row_key, rate> m_sent;
+    std::map<row_key, rate> m_curr;
+};
+
+#endif
@@ -0,0 +1,71 @@
+#ifndef _INCL_STEP_POOL
+#define _INCL_STEP_POOL
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "epoch.pb.hpp"
+
+/*
+ * Recycles EpochStep messages between epochs.
+ *
+ * Clear() on a protobuf message keeps the repeated DeviceComm and L2Summary
+ * objects it already allocated, so a step that goes back through the pool
+ * can hold the next epoch of a similar size without touching the heap.
+ * Steps are handed out as shared_ptrs that return to the pool when the last
+ * reader drops them. The pool must outlive every step it hands out.
+ *
+ * Workers write wire bytes without a step, so mux_server only draws from
+ * the pool for epochs it decodes on the asio thread to merge or rewrite.
+ * bench/step_pool_bench counts the allocations this saves.
+ */
+class step_pool {
+public:
+    typedef std::shared_ptr<epoch::EpochStep> step_ptr;
+
+    explicit step_pool(std::size_t max_free) : m_max_free(max_free) {}
+
+    ~step_pool() {
+        for (epoch::EpochStep *step : m_free) {
+            delete step;
+        }
+    }
+
+    step_pool(const step_pool&) = delete;
+    step_pool& operator=(const step_pool&) = delete;
+
+    step_ptr acquire() {
+        epoch::EpochStep *step = nullptr;
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            if (!m_free.empty()) {
+                step = m_free.back();
+                m_free.pop_back();
+            }
+        }
+        if (step == nullptr) {
+            step = new epoch::EpochStep();
+        }
+        return step_ptr(step, [this](epoch::EpochStep *s) { release(s); });
+    }
+
+private:
+    void release(epoch::EpochStep *step) {
+        step->Clear();
+
+        std::lock_guard<std::mutex> guard(m_lock);
+        if (m_free.size() < m_max_free) {
+            m_free.push_back(step);
+            return;
+        }
+        delete step;
+    }
+
+    std::mutex m_lock;
+    std::vector<epoch::EpochStep*> m_free;
+    std::size_t m_max_free;
+};
+
+#endif
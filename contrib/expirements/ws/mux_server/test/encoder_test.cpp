@@ -0,0 +1,218 @@
+/*
+ * Checks that BrokerCtx::encode_epoch_step writes exactly the bytes of the
+ * EpochStep parse_epoch_step builds from the same Zeek epoch, for well
+ * formed epochs and for every kind of malformed row the parser skips.
+ */
+#include <cstdio>
+#include <functional>
+#include <string>
+
+#include "broker/broker.hh"
+#include "broker/zeek.hh"
+
+#include "epoch.pb.hpp"
+#include "input_parser.hpp"
+
+static int failures = 0;
+
+static broker::address ipv4(uint32_t ip) {
+    return broker::address(&ip, broker::address::family::ipv4, broker::address::byte_order::host);
+}
+
+// One Zeek L2Summary, the counts of a pair of devices or a broadcast pool
+static broker::vector counts(broker::count ipv4, broker::count ipv6, broker::count arp, broker::count unknown) {
+    return broker::vector{ipv4, ipv6, arp, unknown};
+}
+
+// One Zeek DeviceComm, the pools sit at 2 to 5 in the order ff, 33, 01, odd
+static broker::vector dev_comm(broker::table tx_summary, broker::data ff = broker::data{},
+                               broker::data v33 = broker::data{}, broker::data v01 = broker::data{},
+                               broker::data odd = broker::data{}) {
+    return broker::vector{broker::count(0), tx_summary, ff, v33, v01, odd};
+}
+
+static broker::zeek::Event epoch_event(broker::data devices, broker::data comm,
+                                       broker::data addrs, broker::data arp) {
+    broker::vector wrapper{devices, comm, addrs, arp};
+    return broker::zeek::Event("epoch_step", broker::vector{wrapper});
+}
+
+/*
+ * A small network: three devices enter, talk to each other and to the
+ * broadcast pools with every kind of count, and announce addresses and arp
+ * tables.
+ */
+static broker::zeek::Event normal_epoch() {
+    broker::set devices{std::string("00:11:22:33:44:55"),
+                        std::string("aa:bb:cc:dd:ee:ff"),
+                        std::string("02:00:5e:10:00:01")};
+
+    broker::table comm;
+    comm[std::string("00:11:22:33:44:55")] = dev_comm(broker::table{
+        {std::string("aa:bb:cc:dd:ee:ff"), counts(120, 0, 3, 0)},
+        {std::string("02:00:5e:10:00:01"), counts(0, 7, 0, 1)},
+    });
+    comm[std::string("aa:bb:cc:dd:ee:ff")] = dev_comm(broker::table{
+        {std::string("00:11:22:33:44:55"), counts(300000, 70000, 2, 9)},
+    });
+
+    broker::table addrs{
+        {std::string("00:11:22:33:44:55"), ipv4(0xc0a80001)},
+        {std::string("aa:bb:cc:dd:ee:ff"), ipv4(0xc0a80017)},
+    };
+
+    broker::table arp{
+        {std::string("00:11:22:33:44:55"), broker::table{
+            {std::string("aa:bb:cc:dd:ee:ff"), ipv4(0xc0a80017)},
+            {std::string("de:ad:be:ef:00:01"), ipv4(0x0a000001)},
+        }},
+    };
+
+    return epoch_event(devices, comm, addrs, arp);
+}
+
+// Rows that only reach the broadcast and multicast pools
+static broker::zeek::Event bcast_epoch() {
+    broker::table comm;
+    comm[std::string("00:11:22:33:44:55")] = dev_comm(broker::table{},
+        counts(4, 0, 12, 0), counts(0, 33, 0, 0), counts(1, 0, 0, 0), counts(0, 0, 0, 5));
+    comm[std::string("aa:bb:cc:dd:ee:ff")] = dev_comm(broker::table{},
+        counts(0, 0, 0, 0), broker::data{}, counts(9, 9, 9, 9));
+
+    return epoch_event(broker::set{}, comm, broker::table{}, broker::table{});
+}
+
+// Rows broken in every way the parser skips past
+static broker::zeek::Event malformed_rows() {
+    broker::table comm;
+    comm[broker::count(1)] = dev_comm(broker::table{});
+    comm[std::string("00:00:00:00:00:01")] = broker::count(2);
+    comm[std::string("00:00:00:00:00:02")] = broker::vector{broker::count(0), broker::count(3),
+                                                            counts(1, 0, 0, 0), broker::data{},
+                                                            broker::data{}, broker::data{}};
+    comm[std::string("00:00:00:00:00:03")] = dev_comm(broker::table{
+        {broker::count(4), counts(1, 1, 1, 1)},
+        {std::string("00:00:00:00:00:04"), broker::count(5)},
+        {std::string("00:00:00:00:00:05"), broker::vector{broker::count(6), broker::count(7),
+                                                          std::string("x"), broker::count(8)}},
+        {std::string("not a mac"), counts(2, 2, 2, 2)},
+    }, broker::vector{std::string("x"), broker::count(1), broker::count(1), broker::count(1)});
+
+    broker::table addrs{
+        {broker::count(9), ipv4(1)},
+        {std::string("00:00:00:00:00:06"), broker::count(10)},
+        {std::string("00:00:00:00:00:07"), ipv4(0)},
+    };
+
+    broker::table arp{
+        {broker::count(11), broker::table{}},
+        {std::string("00:00:00:00:00:08"), broker::count(12)},
+        {std::string("00:00:00:00:00:09"), broker::table{
+            {broker::count(13), ipv4(1)},
+            {std::string("00:00:00:00:00:0a"), broker::count(14)},
+            {std::string("00:00:00:00:00:0b"), ipv4(0x0a000002)},
+        }},
+        {std::string("00:00:00:00:00:0c"), broker::table{}},
+    };
+
+    return epoch_event(broker::set{}, comm, addrs, arp);
+}
+
+/*
+ * Parses and encodes the event with contexts of their own, so the device
+ * ids both hand out also have to agree, and compares the bytes.
+ */
+static void check(const char *name, std::function<broker::zeek::Event()> make, bool ids,
+                  std::string const& sensor) {
+    device_registry parse_ids, encode_ids;
+
+    BrokerCtx parser;
+    BrokerCtx encoder;
+    if (ids) {
+        parser.registry = &parse_ids;
+        encoder.registry = &encode_ids;
+    }
+
+    broker::zeek::Event parse_event = make();
+    epoch::EpochStep step;
+    parser.parse_epoch_step(parse_event, &step);
+    step.set_sensor(sensor);
+    std::string expected = step.SerializeAsString();
+
+    broker::zeek::Event encode_event = make();
+    std::string encoded;
+    encoder.encode_epoch_step(encode_event, sensor, &encoded);
+
+    epoch::EpochStep decoded;
+    bool parsed = decoded.ParseFromString(encoded);
+    bool ok = parsed && decoded.SerializeAsString() == expected && encoded == expected;
+
+    printf("%-4s %s%s%s\n", ok ? "ok" : "FAIL", name, ids ? " ids" : "",
+           sensor.empty() ? "" : " sensor");
+    if (!ok) {
+        failures++;
+        printf("     expected %zu bytes, encoded %zu bytes%s\n", expected.size(), encoded.size(),
+               parsed ? "" : ", which do not parse");
+    }
+}
+
+int main() {
+    struct fixture {
+        const char *name;
+        std::function<broker::zeek::Event()> make;
+    };
+
+    const fixture fixtures[] = {
+        {"normal epoch", normal_epoch},
+        {"bcast and mcast rows", bcast_epoch},
+        {"malformed rows", malformed_rows},
+        {"empty epoch", [] {
+            return epoch_event(broker::set{}, broker::table{}, broker::table{}, broker::table{});
+        }},
+
+        // Each of these stops the parser before the rest of the epoch
+        {"args not a vector", [] {
+            return broker::zeek::Event("epoch_step", broker::vector{broker::count(1)});
+        }},
+        {"devices not a set", [] {
+            broker::zeek::Event e = normal_epoch();
+            broker::get_if<broker::vector>(e.args().at(0))->at(0) = broker::count(1);
+            return e;
+        }},
+        {"device not a string", [] {
+            broker::zeek::Event e = normal_epoch();
+            broker::vector *wrapper = broker::get_if<broker::vector>(e.args().at(0));
+            broker::get_if<broker::set>(wrapper->at(0))->insert(broker::count(1));
+            return e;
+        }},
+        {"comm not a table", [] {
+            broker::zeek::Event e = normal_epoch();
+            broker::get_if<broker::vector>(e.args().at(0))->at(1) = broker::count(1);
+            return e;
+        }},
+        {"addrs not a table", [] {
+            broker::zeek::Event e = normal_epoch();
+            broker::get_if<broker::vector>(e.args().at(0))->at(2) = broker::count(1);
+            return e;
+        }},
+        {"arp not a table", [] {
+            broker::zeek::Event e = normal_epoch();
+            broker::get_if<broker::vector>(e.args().at(0))->at(3) = broker::count(1);
+            return e;
+        }},
+    };
+
+    for (const fixture &f : fixtures) {
+        for (bool ids : {false, true}) {
+            for (const char *sensor : {"", "trunk-a"}) {
+                check(f.name, f.make, ids, sensor);
+            }
+        }
+    }
+
+    if (failures) {
+        printf("%d failed\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,73 @@
+/*
+ * Times Store's device lookup by mac through Context::MacIndex against the
+ * std::map keyed by fmtEUI48 strings it replaced, at 10k and 100k devices.
+ */
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../mac_index.h"
+
+using namespace Monopticon;
+
+static const int LOOKUPS = 2000000;
+
+static double nsPerLookup(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) {
+    return std::chrono::duration<double, std::nano>(end - start).count()/LOOKUPS;
+}
+
+static int bench(int devices) {
+    std::mt19937_64 rng(devices);
+
+    std::vector<uint64_t> macs;
+    Context::MacIndex index;
+    std::map<std::string, uint32_t> device_map;
+    for (int i = 0; i < devices; i++) {
+        uint64_t mac = rng() & 0xffffffffffffull;
+        macs.push_back(mac);
+        index.insert(mac, i);
+        device_map[Util::fmtEUI48(mac)] = i;
+    }
+
+    // Both must agree before either is timed
+    for (int i = 0; i < devices; i++) {
+        if (index.find(macs[i]) != device_map[Util::fmtEUI48(macs[i])] ||
+            Util::parseEUI48(Util::fmtEUI48(macs[i])) != macs[i]) {
+            std::fprintf(stderr, "lookup mismatch for device %d\n", i);
+            return 1;
+        }
+    }
+
+    // Epochs name devices in no particular order
+    std::vector<uint64_t> queries(LOOKUPS);
+    for (auto it = queries.begin(); it != queries.end(); it++) {
+        *it = macs[rng() % devices];
+    }
+
+    uint64_t sum = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (auto it = queries.begin(); it != queries.end(); it++) {
+        sum += index.find(*it);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    for (auto it = queries.begin(); it != queries.end(); it++) {
+        sum += device_map.find(Util::fmtEUI48(*it))->second;
+    }
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::printf("%6d devices: MacIndex %7.1f ns/lookup, std::map<std::string> %7.1f ns/lookup (%llu)\n",
+                devices, nsPerLookup(t0, t1), nsPerLookup(t1, t2), (unsigned long long)(sum & 0xff));
+    return 0;
+}
+
+int main() {
+    for (int devices : {10000, 100000}) {
+        if (bench(devices) != 0) {
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -23,20 +23,29 @@ Graphic::Graphic() : _glyphCache(Vector2i(2048), Vector2i(512), 22)
     _poolCircle = MeshTools::compile(Primitives::circle3DWireframe(20));
 
     _line_shader = Figure::ParaLineShader{};
-    _phong_shader = Shaders::Phong{Shaders::Phong::Flag::ObjectId};
+    // Permanent since DeleteEverything only empties the batch
+    _packet_lines = new Figure::PacketLineBatch{*new Object3D{&_scene}, _line_shader, _permanent_drawables, _anim_clock, 1 << 15};
+    _flow_shader = Figure::FlowEdgeShader{};
+    _flow_edges = new Figure::FlowEdgeBatch{*new Object3D{&_scene}, _flow_shader, _permanent_drawables, _anim_clock, 1 << 14};
+    _phong_shader = Shaders::Phong{
+        Shaders::Phong::Flag::ObjectId|
+        Shaders::Phong::Flag::InstancedObjectId|
+        Shaders::Phong::Flag::InstancedTransformation|
+        Shaders::Phong::Flag::VertexColor};
     _pool_shader = Figure::PoolShader{};
     _link_shader = Figure::WorldLinkShader{};
 
     _bbitem_shader = Shaders::Flat3D{};
     _bbitem_shader.setColor(0x00ff00_rgbf);
 
+    // Permanent since their instances leave when they are deleted
     {
         Trade::MeshData data = Primitives::uvSphereSolid(8.0f, 30.0f);
-        _sphere = MeshTools::compile(data);
+        _device_batch = new Figure::SelectableBatch{*new Object3D{&_scene}, _phong_shader, MeshTools::compile(data), Color3{}, _selectable_drawables};
     }
     {
         Trade::MeshData data = Primitives::cubeSolid();
-        _cubeMesh = MeshTools::compile(data);
+        _address_batch = new Figure::SelectableBatch{*new Object3D{&_scene}, _phong_shader, MeshTools::compile(data), Color3{0.2f}, _selectable_drawables};
     }
 
     prepare3DFont();
@@ -48,9 +57,11 @@ void Graphic::prepareGLBuffers(const Range2Di &viewport)
 
     // Prepare the object select buffer;
     _objectId.setStorage(GL::RenderbufferFormat::R32UI, viewport.size());
+    _depth.setStorage(GL::RenderbufferFormat::DepthComponent24, viewport.size());
 
     _objselect_framebuffer = GL::Framebuffer{viewport};
     _objselect_framebuffer.attachRenderbuffer(GL::Framebuffer::ColorAttachment{1}, _objectId)
+        .attachRenderbuffer(GL::Framebuffer::BufferAttachment::Depth, _depth)
         .mapForDraw({{Shaders::Phong::ObjectIdOutput, GL::Framebuffer::ColorAttachment{1}}});
 
 
@@ -60,6 +71,7 @@ void Graphic::prepareGLBuffers(const Range2Di &viewport)
 void Graphic::destroyGLBuffers()
 {
     _objselect_framebuffer.detach(GL::Framebuffer::ColorAttachment{1});
+    _objselect_framebuffer.detach(GL::Framebuffer::BufferAttachment::Depth);
 }
 
 void Graphic::prepare3DFont()
@@ -102,24 +114,22 @@ Device::Stats *Graphic::createSphere(Store *sCtx, const std::string mac, Object3
     o->translate(relPos);
     sphere_obj->transform(Matrix4::scaling(Vector3{0.25f}));
 
-    UnsignedByte id = sCtx->NewObjectId();
+    UnsignedInt id = sCtx->NewObjectId();
 
     Color3 c = 0xa5c9ea_rgbf;
     Figure::DeviceDrawable *dev = new Figure::DeviceDrawable{
         id,
         *sphere_obj,
-        _phong_shader,
+        *_device_batch,
         c,
-        _sphere,
-        Matrix4{},
-        _selectable_drawables};
+        Matrix4{}};
 
 
     Device::Stats *d_s = new Device::Stats{mac, o, dev};
     dev->_deviceStats = d_s;
 
     sCtx->_selectable_objects.push_back(d_s);
-    sCtx->_device_map.insert(std::make_pair(mac, d_s));
+    sCtx->addDevice(Util::parseEUI48(mac), d_s);
 
     return d_s;
 }
@@ -140,15 +150,13 @@ Monopticon::Level3::Address *Graphic::createIPv4Address(Context::Store *sCtx, co
 
     Color3 c = 0xffffff_rgbf;
 
-    UnsignedByte id = sCtx->NewObjectId();
+    UnsignedInt id = sCtx->NewObjectId();
 
     Level3::Address *address_obj = new Level3::Address{
         id,
         *o,
-        _phong_shader,
-        c,
-        _cubeMesh,
-        _selectable_drawables};
+        *_address_batch,
+        c};
 
     sCtx->_selectable_objects.push_back(address_obj);
 
@@ -179,10 +187,16 @@ Monopticon::Device::PrefixStats *Graphic::createBroadcastPool(const std::string
 
     Device::PrefixStats *dp_s = new Device::PrefixStats{mac_prefix, pos, ring};
 
+    // One object draws every ring of the pool, at most 10 at a time
+    Object3D *o = new Object3D{&_scene};
+    o->rotateX(90.0_degf);
+    o->translate(pos);
+    dp_s->hits = new Figure::MulticastDrawable(*o, dp_s->_position, _pool_shader, _permanent_drawables, _poolCircle, _anim_clock, 10);
+
     return dp_s;
 }
 
-void Graphic::createPoolHits(Context::Store *sCtx, Device::Stats *tran_d_s, Device::PrefixStats *dp_s, epoch::L2Summary sum)
+void Graphic::createPoolHits(Context::Store *sCtx, Device::Stats *tran_d_s, Device::PrefixStats *dp_s, const epoch::L2Summary &sum)
 {
     using namespace Monopticon::Util;
 
@@ -213,22 +227,7 @@ void Graphic::createPoolHits(Context::Store *sCtx, Device::Stats *tran_d_s, Devi
 void Graphic::createPoolHit(Device::PrefixStats *dp_s, Color3 c)
 {
     // No-op if the contact pool is already drawing lots of rings
-    if (dp_s->contacts.size() > 9)
-    {
-        return;
-    }
-    auto pos = dp_s->_position;
-
-    auto scaling = Matrix4::scaling(Vector3{1.0f});
-    Object3D *o = new Object3D{&_scene};
-    o->transform(scaling);
-    o->rotateX(90.0_degf);
-    //u->rotateX(270.0_degf);
-    o->translate(pos);
-
-    auto top = new Figure::MulticastDrawable(*o, c, pos, _pool_shader, _drawables, _poolCircle);
-
-    dp_s->contacts.push_back(top);
+    dp_s->hits->add(c);
 }
 
 
@@ -326,19 +325,13 @@ void Graphic::addL2ConnectL3(Vector3 a, Vector3 b)
     line->setMesh(Primitives::line3D(a, a + c));
 }
 
-void Graphic::createLines(Context::Store *sCtx, Vector3 a, Vector3 b, Util::L3Type t, int count)
+void Graphic::addFlow(Device::Stats *tran_d_s, Device::Stats *recv_d_s, const Vector4& counts)
 {
-    int ceiling = std::min(count, 4);
-    for (int i = 0; i < ceiling; i++)
-    {
-        createLine(sCtx, a, b, t);
-    }
+    _flow_edges->add({tran_d_s, recv_d_s}, tran_d_s->circPoint, recv_d_s->circPoint, counts);
 }
 
 void Graphic::createLine(Context::Store *sCtx, Vector3 a, Vector3 b, Util::L3Type t)
 {
-    Object3D *line = new Object3D{&_scene};
-
     Color3 c = Util::typeColor(t);
     Color4 c4;
     /*
@@ -356,22 +349,23 @@ void Graphic::createLine(Context::Store *sCtx, Vector3 a, Vector3 b, Util::L3Typ
     c4 = Color4(c, 1.0);
     // TODO delete line above
 
-    auto *pl = new Figure::PacketLineDrawable{*line, _line_shader, a, b, _drawables, c4};
-    // TODO insert move INSERT into sCtx SceneContext
-    sCtx->_packet_line_queue.insert(pl);
+    _packet_lines->add(a, b, c4);
 }
 
-void Graphic::draw3DElements()
+void Graphic::rebaseAnimations(Store *sCtx, Float by)
 {
-    // Ensure the custom framebuffer is clear for the draw
-    _objselect_framebuffer
-        .clearColor(1, Vector4ui{})
-        .bind();
+    _anim_clock -= by;
+    _packet_lines->rebase(by);
+    _flow_edges->rebase(by);
+    for (auto it = sCtx->_dst_prefix_group_map.begin(); it != sCtx->_dst_prefix_group_map.end(); it++) {
+        it->second->hits->rebase(by);
+    }
+}
 
-    // Draw selectable objects to custom framebuffer
-    _camera->draw(_selectable_drawables);
 
-    /* Bind the main buffer back */
+void Graphic::draw3DElements()
+{
+    // Object ids are only drawn when a click is picked, see pickObjectId()
     GL::defaultFramebuffer.clear(GL::FramebufferClear::Color | GL::FramebufferClear::Depth)
         .bind();
 
@@ -390,20 +384,66 @@ void Graphic::draw3DElements()
     GL::Renderer::disable(GL::Renderer::Feature::Blending);
 }
 
+UnsignedInt Graphic::pickObjectId(const Vector2i& fbPosition)
+{
+    // The integer attachment cannot be multisampled like the default
+    // framebuffer, so the ids get their own pass instead of a second
+    // output of the one that draws the scene
+    _objselect_framebuffer
+        .clearColor(1, Vector4ui{})
+        .clear(GL::FramebufferClear::Depth)
+        .bind();
+
+    GL::Renderer::enable(GL::Renderer::Feature::DepthTest);
+    GL::Renderer::enable(GL::Renderer::Feature::FaceCulling);
+
+    _camera->draw(_selectable_drawables);
+
+    GL::Renderer::disable(GL::Renderer::Feature::FaceCulling);
+    GL::Renderer::disable(GL::Renderer::Feature::DepthTest);
+
+    _objselect_framebuffer.mapForRead(GL::Framebuffer::ColorAttachment{1});
+    Image2D data = _objselect_framebuffer.read(
+        Range2Di::fromSize(fbPosition, {1, 1}),
+        {PixelFormat::R32UI});
+
+    GL::defaultFramebuffer.bind();
+
+    return data.pixels<UnsignedInt>()[0][0];
+}
+
 Store::Store()
 {
 }
 
-UnsignedByte Store::NewObjectId()
+Device::Stats* Store::findDevice(uint64_t mac) const
 {
-    return static_cast<UnsignedByte>(_selectable_objects.size());
+    uint32_t i = _device_index.find(mac);
+    if (i == MacIndex::NONE) {
+        return nullptr;
+    }
+    return _devices[i];
+}
+
+void Store::addDevice(uint64_t mac, Device::Stats *d_s)
+{
+    // Devices named by a mac that did not parse are listed but not indexed
+    if (mac != Util::MAC_NONE) {
+        _device_index.insert(mac, _devices.size());
+    }
+    _devices.push_back(d_s);
+}
+
+UnsignedInt Store::NewObjectId()
+{
+    return static_cast<UnsignedInt>(_selectable_objects.size());
 }
 
 Vector2 Store::NextVlanPos()
 {
     int row_size = 4;
 
-    int num_objs_in_vlan = _device_map.size(); // NOTE replace with vlan
+    int num_objs_in_vlan = _devices.size(); // NOTE replace with vlan
 
     int vlan_x = num_objs_in_vlan / row_size;
     int vlan_y = num_objs_in_vlan % row_size;
@@ -413,33 +453,9 @@ Vector2 Store::NextVlanPos()
 
 
 void Store::FrameUpdate() {
-    // Remove packet_lines that have expired from the queue
-    std::set<Figure::PacketLineDrawable *>::iterator it;
-    for (it = _packet_line_queue.begin(); it != _packet_line_queue.end(); ) {
-        // Note this is an O(N) operation
-        Figure::PacketLineDrawable *pl = *it;
-        if (pl->_expired) {
-            it = _packet_line_queue.erase(it);
-            delete pl;
-        } else {
-            ++it;
-        }
-    }
-
-    // Remove mcast drawables that have expired
-    for (auto it2 = _dst_prefix_group_map.begin(); it2 != _dst_prefix_group_map.end(); it2++) {
-        Device::PrefixStats *dp_s = (*it2).second;
-        std::vector<Figure::MulticastDrawable*> c = dp_s->contacts;
-        for (auto it3 = c.begin(); it3 != c.end(); ) {
-            Figure::MulticastDrawable* mcast = *it3;
-            if (mcast->expired) {
-                it3 = c.erase(it3);
-                delete mcast;
-            } else {
-                ++it3;
-            }
-        }
-        dp_s->contacts = c;
+    // Drop the broadcast rings that finished
+    for (auto it = _dst_prefix_group_map.begin(); it != _dst_prefix_group_map.end(); it++) {
+        it->second->hits->expire();
     }
 }
 
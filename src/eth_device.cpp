@@ -150,7 +150,7 @@ Stats::~Stats() {
 
 
 PrefixStats::PrefixStats(std::string macPrefix, Vector3 pos, Figure::RingDrawable* ring):
-    contacts{},
+    hits{nullptr},
     _prefix{macPrefix},
     _position{pos},
     ring{ring}
@@ -159,10 +159,9 @@ PrefixStats::PrefixStats(std::string macPrefix, Vector3 pos, Figure::RingDrawabl
 
 PrefixStats::~PrefixStats() {
     delete ring;
-    for (auto it = contacts.begin(); it != contacts.end(); it++) {
-        Figure::MulticastDrawable* mcast = *it;
-        it = contacts.erase(it);
-        delete mcast;
+    if (hits != nullptr) {
+        // Deleting the object takes its drawable with it
+        delete &hits->_object;
     }
 }
 
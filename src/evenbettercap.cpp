@@ -81,7 +81,8 @@ class Application: public Platform::Application {
         std::vector<std::string> _iface_list;
         std::string _chosen_iface;
 
-        Timeline _timeline;
+        // Start of the epoch the animation clock counts from
+        std::chrono::steady_clock::time_point _anim_epoch;
 
         int run_sum;
         int frame_cnt;
@@ -114,7 +115,7 @@ Application::Application(const Arguments& arguments):
     run_sum = 0;
     frame_cnt = 0;
 
-    _timeline.start();
+    _anim_epoch = std::chrono::steady_clock::now();
 
     PrepareDrawables();
 
@@ -157,6 +158,9 @@ void Application::DetectExecutionContext() {
 
     ws_uri = std::string(ws_cstr);
 
+    // Pass options like ?interval=1000 from the page URL on to the mux_server
+    ws_uri.append(emscripten_run_script_string("window.location.search"));
+
     // Detect firefox to disable object select for issue #7.
     {
         int res = emscripten_run_script_int("navigator.userAgent.indexOf('Firefox') != -1");
@@ -226,6 +230,7 @@ void Application::drawIMGuiElements() {
 
     ImGui::Text("App average %.3f ms/frame (%.1f FPS)",
             1000.0/Magnum::Double(ImGui::GetIO().Framerate), Magnum::Double(ImGui::GetIO().Framerate));
+    ImGui::Text("Active flows %zu", gCtx->_flow_edges->size());
 
     wCtx->statsGui();
 
@@ -256,8 +261,8 @@ void Application::drawIMGuiElements() {
     ImGui::Separator();
     ImGui::BeginChild("Scrolling");
     int i = 1;
-    for (auto it = sCtx->_device_map.begin(); it != sCtx->_device_map.end(); it++) {
-        Device::Stats *d_s = it->second;
+    for (auto it = sCtx->_devices.begin(); it != sCtx->_devices.end(); it++) {
+        Device::Stats *d_s = *it;
 
         char b[4] = {};
         sprintf(b, "%d", i);
@@ -359,6 +364,17 @@ void Application::watchSelectedDevice() {
 
 
 void Application::drawEvent() {
+    // Animations follow the wall clock so slow frames skip ahead instead
+    // of piling up. A Float of seconds since startup is too coarse after
+    // days, 1/16 s after 6, so the clock restarts every epoch.
+    double clock = std::chrono::duration<double>(std::chrono::steady_clock::now() - _anim_epoch).count();
+    while (clock >= ANIMATION_EPOCH) {
+        _anim_epoch += std::chrono::seconds(Long(ANIMATION_EPOCH));
+        clock -= ANIMATION_EPOCH;
+        gCtx->rebaseAnimations(sCtx, ANIMATION_EPOCH);
+    }
+    gCtx->_anim_clock = Float(clock);
+
     wCtx->frameUpdate();
 
     sCtx->FrameUpdate();
@@ -371,7 +387,6 @@ void Application::drawEvent() {
 
     frame_cnt ++;
     swapBuffers();
-    _timeline.nextFrame();
     redraw();
 }
 
@@ -383,18 +398,14 @@ void Application::DeleteEverything() {
             delete obj;
         }
 
-        // All the Stats ptrs in device_map are included in _selectable_objects
+        // All the Stats ptrs in _devices are included in _selectable_objects
         sCtx->_selectable_objects.clear();
-        sCtx->_device_map.clear();
-    }
-    {
-        for (auto it = sCtx->_packet_line_queue.begin(); it != sCtx->_packet_line_queue.end(); it++) {
-            Figure::PacketLineDrawable *obj = *it;
-            delete obj;
-        }
-
-        sCtx->_packet_line_queue.clear();
+        sCtx->_devices.clear();
+        sCtx->_device_index.clear();
+        sCtx->_device_ids.clear();
     }
+    gCtx->_packet_lines->clear();
+    gCtx->_flow_edges->clear();
     {
         for (auto it = sCtx->_dst_prefix_group_map.begin(); it != sCtx->_dst_prefix_group_map.end(); it++) {
             Device::PrefixStats *obj = it->second;
@@ -423,7 +434,6 @@ void Application::DeleteEverything() {
 
     // Reset scene state
     gCtx->_drawables = SceneGraph::DrawableGroup3D{};
-    gCtx->_selectable_drawables = SceneGraph::DrawableGroup3D{};
     gCtx->_billboard_drawables = SceneGraph::DrawableGroup3D{};
     gCtx->_text_drawables = SceneGraph::DrawableGroup3D{};
 
@@ -499,12 +509,7 @@ void Application::mouseReleaseEvent(MouseEvent& event) {
         const Vector2i position = event.position()*Vector2{framebufferSize()}/Vector2{windowSize()};
         const Vector2i fbPosition{position.x(), GL::defaultFramebuffer.viewport().sizeY() - position.y() - 1};
 
-        gCtx->_objselect_framebuffer.mapForRead(GL::Framebuffer::ColorAttachment{1});
-        Image2D data = gCtx->_objselect_framebuffer.read(
-            Range2Di::fromSize(fbPosition, {1, 1}),
-            {PixelFormat::R32UI});
-
-        UnsignedInt id = data.pixels<UnsignedInt>()[0][0];
+        UnsignedInt id = gCtx->pickObjectId(fbPosition);
 
         if(id > 0 && id < sCtx->_selectable_objects.size()+1) {
             Device::Selectable *selection = sCtx->_selectable_objects.at(id-1);
@@ -2,14 +2,20 @@
 #define _INCL_ebc
 
 #include <assert.h>
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdio>
 #include <ctime>
+#include <deque>
 #include <iomanip>
 #include <iostream>
 #include <istream>
 #include <math.h>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <set>
 #include <sstream>
@@ -17,11 +23,14 @@
 #include <stdio.h>
 #include <streambuf>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <unordered_map>
 #include <map>
 #include <unistd.h>
 
 #include <arpa/inet.h>
+#include <zlib.h>
 
 #include <emscripten.h>
 #include <emscripten/websocket.h>
@@ -75,7 +84,6 @@
 #include <Magnum/Shaders/MeshVisualizer.h>
 #include <Magnum/Shaders/Phong.h>
 #include <Magnum/Shaders/VertexColor.h>
-#include <Magnum/Timeline.h>
 #include <Magnum/Text/AbstractFont.h>
 #include <Magnum/Text/DistanceFieldGlyphCache.h>
 #include <Magnum/Text/Renderer.h>
@@ -86,6 +94,7 @@
 
 // TODO move to src
 #include "../contrib/expirements/ws/newproto/epoch.pb.h"
+#include "mac_index.h"
 
 using namespace Magnum;
 using namespace Math::Literals;
@@ -131,12 +140,7 @@ namespace Monopticon {
 
 // Definitions
 namespace Util {
-    int SumTotal(epoch::L2Summary struct_l2);
-
-    /*
-     * Converts a mac to a string
-     */
-    std::string fmtEUI48(const uint64_t & mac);
+    int SumTotal(const epoch::L2Summary &struct_l2);
 
     /*
      * Converts a uint32 probably from a protobuf to an ipv4 address string.
@@ -231,7 +235,8 @@ class PrefixStats {
     PrefixStats(std::string macPrefix, Vector3 pos, Figure::RingDrawable* ring);
     ~PrefixStats();
 
-    std::vector<Figure::MulticastDrawable*> contacts;
+    // Rings drawn in the pool when a device broadcasts into it
+    Figure::MulticastDrawable *hits;
 
     std::string _prefix;
     Vector3     _position;
@@ -285,45 +290,96 @@ class RouteMgr {
 
 } // Device
 
-namespace Level3 {
+namespace Figure {
 
-class Address: public Device::Selectable, public Object3D, public SceneGraph::Drawable3D {
-  public:
-    explicit Address(UnsignedByte id, Object3D& object, Shaders::Phong& shader, Color3 &color, GL::Mesh& mesh, SceneGraph::DrawableGroup3D& drawables);
+class SelectableBatch;
 
-    Object3D& getObj() override;
-    Vector3 getTranslation() override;
-    int rightClickActions() override;
+/**
+ * @brief Anything drawn as one instance of a SelectableBatch
+ *
+ * Joins the batch when constructed and leaves it when destroyed. The
+ * batch asks for the transformation and color every frame.
+ */
+class SelectableInstance {
+    public:
+        virtual ~SelectableInstance();
 
-    std::string value;
+        virtual Matrix4 instanceTransformation() = 0;
+        virtual Color3 instanceColor() = 0;
 
-  private:
-    void draw(const Matrix4& transformation, SceneGraph::Camera3D& camera) override;
+        UnsignedInt objectId() const { return _id; }
 
-    UnsignedByte _id;
-    Color3 _color;
-    Shaders::Phong& _shader;
-    GL::Mesh& _mesh;
+    protected:
+        explicit SelectableInstance(SelectableBatch& batch, UnsignedInt id);
+
+    private:
+        friend SelectableBatch;
+
+        // nullptr once the batch is gone
+        SelectableBatch* _batch;
+        UnsignedInt _id;
+        // Index of the instance in the batch
+        size_t _slot;
 };
 
-} // Level3
+/**
+ * @brief Every selectable object sharing a mesh drawn with one instanced call
+ *
+ * Each instance carries its transformation, color and object id, so the
+ * same call draws to the screen and into the object id framebuffer when
+ * a click is picked. Instances are read back from their members every
+ * frame and only the ones that changed are uploaded.
+ */
+class SelectableBatch: public SceneGraph::Drawable3D {
+    public:
+        explicit SelectableBatch(Object3D& object, Shaders::Phong& shader, GL::Mesh&& mesh, const Color3& ambient, SceneGraph::DrawableGroup3D& group);
+        ~SelectableBatch();
 
-namespace Figure {
+        size_t size() const { return _members.size(); }
 
-class DeviceDrawable: public Object3D, public SceneGraph::Drawable3D {
+    private:
+        friend SelectableInstance;
+
+        struct Instance {
+            Matrix4 transformation;
+            Matrix3x3 normalMatrix;
+            Color3 color;
+            UnsignedInt objectId;
+        };
+
+        void add(SelectableInstance* member);
+        void remove(SelectableInstance* member);
+        void markDirty(size_t i);
+
+        void draw(const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera) override;
+
+        Shaders::Phong& _shader;
+        GL::Mesh _mesh;
+        GL::Buffer _instanceBuffer;
+        // Multiplied with the color of every instance
+        Color3 _ambient;
+
+        std::vector<SelectableInstance*> _members;
+        std::vector<Instance> _instances;
+        // Instances _instanceBuffer has room for
+        size_t _bufferCapacity{0};
+        // Slots [_dirtyBegin, _dirtyEnd) differ from _instanceBuffer
+        size_t _dirtyBegin{0};
+        size_t _dirtyEnd{0};
+};
+
+class DeviceDrawable: public Object3D, public SelectableInstance {
     public:
-        explicit DeviceDrawable(UnsignedByte id, Object3D& object, Shaders::Phong& shader, Color3 &color, GL::Mesh& mesh, const Matrix4& primitiveTransformation, SceneGraph::DrawableGroup3D& drawables);
+        explicit DeviceDrawable(UnsignedInt id, Object3D& object, SelectableBatch& batch, Color3 &color, const Matrix4& primitiveTransformation);
 
         Device::Stats * _deviceStats;
         void resetTParam();
 
-    private:
-        void draw(const Matrix4& transformation, SceneGraph::Camera3D& camera) override;
+        Matrix4 instanceTransformation() override;
+        Color3 instanceColor() override;
 
-        UnsignedByte _id;
+    private:
         Color3 _color;
-        Shaders::Phong& _shader;
-        GL::Mesh& _mesh;
         Matrix4 _primitiveTransformation;
         float _t;
 };
@@ -344,42 +400,164 @@ class RingDrawable: public Object3D, public SceneGraph::Drawable3D {
         Shaders::Flat3D _shader = Shaders::Flat3D{};
 };
 
+// Animations advance this many units per second of the animation clock,
+// what they used to advance per frame at 60 FPS
+const Float ANIMATION_RATE = 2.4f;
+
+// Seconds the animation clock runs before it is moved back to 0, so it
+// stays fine enough to tell frames apart. Stored spawn times are rebased
+// by as much.
+const Float ANIMATION_EPOCH = 4096.0f;
+
+/**
+ * @brief Draws every packet line in flight as one instance each
+ *
+ * The two vertices of the line mesh only say which end they are, where
+ * the line is comes from the instance attributes.
+ */
 class ParaLineShader: public GL::AbstractShaderProgram {
     public:
-        typedef GL::Attribute<0, Vector3> Position;
+        // 0 at the sender, 1 at the receiver
+        typedef GL::Attribute<0, Float> Endpoint;
+        typedef GL::Attribute<1, Vector3> APos;
+        typedef GL::Attribute<2, Vector3> BPos;
+        typedef GL::Attribute<3, Color4> Color;
+        typedef GL::Attribute<4, Float> SpawnTime;
 
         explicit ParaLineShader();
 
-        ParaLineShader& setColor(const Color4& color);
-        ParaLineShader& setAPos(const Vector3& position);
-        ParaLineShader& setBPos(const Vector3& position);
-        ParaLineShader& setTParam(const float t);
+        ParaLineShader& setTime(const float t);
         ParaLineShader& setTransformationProjectionMatrix(const Matrix4& matrix);
 
     private:
-        Int _colorUniform,
-            _aPosUniform,
-            _bPosUniform,
-            _tParamUniform,
+        Int _timeUniform,
             _transformationProjectionMatrixUniform;
 };
 
-class PacketLineDrawable: public SceneGraph::Drawable3D {
+/**
+ * @brief Every packet line in flight drawn with a single instanced call
+ *
+ * Lines live in a fixed ring of instance slots. A line travels for one
+ * unit of time, so once the ring wraps the slot it overwrites is the
+ * oldest one and almost always finished. Only slots written since the
+ * last frame are uploaded.
+ */
+class PacketLineBatch: public SceneGraph::Drawable3D {
     public:
-        explicit PacketLineDrawable(Object3D& object, ParaLineShader& shader, Vector3& a, Vector3& b, SceneGraph::DrawableGroup3D& group, Color4 c);
+        explicit PacketLineBatch(Object3D& object, ParaLineShader& shader, SceneGraph::DrawableGroup3D& group, const Float& clock, UnsignedInt capacity);
 
-        Object3D &_object;
-        bool _expired;
+        void add(const Vector3& a, const Vector3& b, const Color4& c);
+        void clear();
+
+        // Moves every line back by seconds as the animation clock is
+        void rebase(Float by);
 
     private:
+        struct Instance {
+            Vector3 a;
+            Vector3 b;
+            Color4 color;
+            Float spawnTime;
+        };
+
         void draw(const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera) override;
+        void upload(UnsignedLong from, UnsignedLong to);
 
-        GL::Mesh _mesh;
         ParaLineShader& _shader;
-        Vector3 _a;
-        Vector3 _b;
-        float _t;
-        Color4 _c;
+        GL::Buffer _endpoints;
+        GL::Buffer _instanceBuffer;
+        GL::Mesh _mesh;
+
+        std::vector<Instance> _instances;
+        // Lines ever added and lines already in _instanceBuffer
+        UnsignedLong _written{0};
+        UnsignedLong _uploaded{0};
+        // Seconds of the animation clock, a line is done once it is
+        // 1.0/ANIMATION_RATE old
+        const Float& _clock;
+};
+
+// Seconds for the packets counted on a flow edge to fall to 1/e
+const Float FLOW_DECAY = 2.0f;
+// Edges with fewer decayed packets than this are not drawn
+const Float FLOW_CUTOFF = 0.5f;
+
+/**
+ * @brief Draws every flow edge as one instance of an arc
+ *
+ * Packet counts per L3 type decay in the shader from when they were last
+ * written, so an idle edge fades without being uploaded again. The rate
+ * they imply sets the brightness and how many pulses run along the arc.
+ */
+class FlowEdgeShader: public GL::AbstractShaderProgram {
+    public:
+        // 0 at the sender, 1 at the receiver
+        typedef GL::Attribute<0, Float> Along;
+        typedef GL::Attribute<1, Vector3> APos;
+        typedef GL::Attribute<2, Vector3> BPos;
+        // IPV4, IPV6, ARP and UNKNOWN packets as of LastSeen
+        typedef GL::Attribute<3, Vector4> Counts;
+        typedef GL::Attribute<4, Float> LastSeen;
+
+        explicit FlowEdgeShader();
+
+        FlowEdgeShader& setTime(const float t);
+        FlowEdgeShader& setTransformationProjectionMatrix(const Matrix4& matrix);
+
+    private:
+        Int _timeUniform,
+            _transformationProjectionMatrixUniform;
+};
+
+/**
+ * @brief One persistent edge per communicating pair of devices
+ *
+ * Traffic between a pair only updates the counts of its edge, all edges
+ * are drawn with a single instanced call. Edges whose rate has decayed
+ * to nothing are swept out about once a second.
+ */
+class FlowEdgeBatch: public SceneGraph::Drawable3D {
+    public:
+        typedef std::pair<const Device::Stats*, const Device::Stats*> Key;
+
+        explicit FlowEdgeBatch(Object3D& object, FlowEdgeShader& shader, SceneGraph::DrawableGroup3D& group, const Float& clock, UnsignedInt capacity);
+
+        void add(Key key, const Vector3& a, const Vector3& b, const Vector4& counts);
+        void clear();
+
+        // Moves every edge back by seconds as the animation clock is
+        void rebase(Float by);
+
+        size_t size() const { return _instances.size(); }
+
+    private:
+        struct Instance {
+            Vector3 a;
+            Vector3 b;
+            Vector4 counts;
+            Float lastSeen;
+        };
+
+        void draw(const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera) override;
+        void sweep();
+        void markDirty(size_t i);
+
+        FlowEdgeShader& _shader;
+        GL::Buffer _along;
+        GL::Buffer _instanceBuffer;
+        GL::Mesh _mesh;
+
+        UnsignedInt _capacity;
+        std::vector<Instance> _instances;
+        // The key of the edge in the same slot of _instances
+        std::vector<Key> _keys;
+        std::map<Key, UnsignedInt> _slots;
+
+        // Slots [_dirtyBegin, _dirtyEnd) differ from _instanceBuffer
+        size_t _dirtyBegin{0};
+        size_t _dirtyEnd{0};
+        Float _lastSweep{0.0f};
+        const Float& _clock;
 };
 
 class UnitBoardDrawable: public SceneGraph::Drawable3D {
@@ -450,21 +628,90 @@ class PoolShader: public GL::AbstractShaderProgram {
             _transformationProjectionMatrixUniform;
 };
 
+/**
+ * @brief Fixed capacity ring of transient animations in spawn order
+ *
+ * Every animation lives equally long, so the oldest are always at the
+ * tail and expiring them is advancing the tail. Slots are reused, the
+ * ring never allocates after construction.
+ */
+template<typename T>
+class AnimationRing {
+    public:
+        explicit AnimationRing(size_t capacity): _slots(capacity) {}
+
+        // Returns the new youngest slot or nullptr when the ring is full
+        T* push() {
+            if (_size == _slots.size()) {
+                return nullptr;
+            }
+            T *slot = &_slots[(_tail + _size) % _slots.size()];
+            _size++;
+            return slot;
+        }
+
+        // The i-th oldest animation
+        T& operator[](size_t i) {
+            return _slots[(_tail + i) % _slots.size()];
+        }
+
+        void pop() {
+            _tail = (_tail + 1) % _slots.size();
+            _size--;
+        }
+
+        void clear() {
+            _tail = 0;
+            _size = 0;
+        }
+
+        size_t size() const {
+            return _size;
+        }
+
+    private:
+        std::vector<T> _slots;
+        size_t _tail{0};
+        size_t _size{0};
+};
+
+/**
+ * @brief The rings of every broadcast into one pool
+ */
 class MulticastDrawable: public SceneGraph::Drawable3D {
     public:
-        explicit MulticastDrawable(Object3D& object, Color3 c, Vector3& origin, PoolShader& shader, SceneGraph::DrawableGroup3D& group, GL::Mesh& mesh);
+        explicit MulticastDrawable(Object3D& object, Vector3& origin, PoolShader& shader, SceneGraph::DrawableGroup3D& group, GL::Mesh& mesh, const Float& clock, size_t capacity);
 
         Object3D &_object;
-        bool expired;
+
+        // Returns false when the pool already draws as many rings as it can
+        bool add(Color3 c);
+
+        /**
+         * @brief Drops the rings that finished
+         *
+         * Costs only as much as the number of rings dropped.
+         */
+        void expire();
+
+        // Moves every ring back by seconds as the animation clock is
+        void rebase(Float by);
 
     private:
+        struct Hit {
+            Color3 c;
+            float spawn;
+        };
+
         void draw(const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera) override;
 
         PoolShader& _shader;
-        Color3 _c;
         Vector3 _origin;
         GL::Mesh &_mesh;
-        float _t;
+        AnimationRing<Hit> _hits;
+        // Seconds of the animation clock, a ring is done once it is
+        // 2.4/ANIMATION_RATE old
+        const Float& _clock;
 };
 
 class WorldLinkShader: public GL::AbstractShaderProgram {
@@ -505,6 +752,27 @@ class WorldScreenLink: public SceneGraph::Drawable3D {
 
 } // Figure
 
+namespace Level3 {
+
+class Address: public Device::Selectable, public Object3D, public Figure::SelectableInstance {
+  public:
+    explicit Address(UnsignedInt id, Object3D& object, Figure::SelectableBatch& batch, Color3 &color);
+
+    Object3D& getObj() override;
+    Vector3 getTranslation() override;
+    int rightClickActions() override;
+
+    Matrix4 instanceTransformation() override;
+    Color3 instanceColor() override;
+
+    std::string value;
+
+  private:
+    Color3 _color;
+};
+
+} // Level3
+
 namespace Layout {
 
 struct RIface {
@@ -647,7 +915,7 @@ class Store {
         Store();
 
         Vector2 NextVlanPos();
-        UnsignedByte NewObjectId();
+        UnsignedInt NewObjectId();
 
         /**
          * @brief Clean up expired items
@@ -657,11 +925,21 @@ class Store {
          **/
         void FrameUpdate();
 
+        /**
+         * @brief Returns the device with this mac or nullptr
+         */
+        Device::Stats* findDevice(uint64_t mac) const;
+        void addDevice(uint64_t mac, Device::Stats *d_s);
+
         // Scene objects
         std::vector<Device::Selectable*>      _selectable_objects{};
-        std::set<Figure::PacketLineDrawable*> _packet_line_queue{};
 
-        std::map<std::string, Device::Stats*>       _device_map{};
+        // Every device in the order it was created, _device_index maps macs
+        // to positions in it
+        std::vector<Device::Stats*>                 _devices{};
+        MacIndex                                    _device_index{};
+        // Indexed by the ids mux_server gives devices, nullptr for unknown ids
+        std::vector<Device::Stats*>                 _device_ids{};
         std::map<std::string, Device::PrefixStats*> _dst_prefix_group_map{};
         std::map<std::string, Device::PrefixStats*> _prefix_group_map{};
 
@@ -678,6 +956,22 @@ class Graphic {
 
         void draw3DElements();
 
+        /**
+         * @brief Moves the animation clock and every animation back
+         *
+         * Spawn times keep their distance to the clock, so nothing in
+         * flight jumps.
+         */
+        void rebaseAnimations(Store *sCtx, Float by);
+
+        /**
+         * @brief Returns the object id under a framebuffer position
+         *
+         * Draws the selectable batches into the object id framebuffer,
+         * 0 is returned where there is no object.
+         */
+        UnsignedInt pickObjectId(const Vector2i& fbPosition);
+
         Device::Stats* createSphere(Store *sCtx, const std::string mac);
 
         Device::Stats* createSphere(Store *sCtx, const std::string mac, Object3D *parent, Vector3 relPos);
@@ -687,11 +981,12 @@ class Graphic {
         Layout::Router* createRouter(Store *sCtx, Layout::RouterParam *param);
         void createDevice(Store *sCtx, Layout::VlanDevice *vlan_dev);
 
-        void createPoolHits(Store *sCtx, Device::Stats* tran_d_s, Device::PrefixStats *dp_s, epoch::L2Summary sum);
+        void createPoolHits(Store *sCtx, Device::Stats* tran_d_s, Device::PrefixStats *dp_s, const epoch::L2Summary &sum);
         void createPoolHit(Device::PrefixStats *dp_s, Color3 c);
         Level3::Address* createIPv4Address(Store *sCtx, const std::string ipv4_addr, Device::Stats* d_s);
 
-        void createLines(Store *sCtx, Vector3, Vector3, Util::L3Type, int num);
+        // Counts are packets per L3 type in the order of FlowEdgeShader::Counts
+        void addFlow(Device::Stats *tran_d_s, Device::Stats *recv_d_s, const Vector4& counts);
         void createLine(Store *sCtx, Vector3, Vector3, Util::L3Type);
 
         void addDirectLabels(Device::Stats *d_s, std::string bottom_lbl);
@@ -700,12 +995,22 @@ class Graphic {
         void destroyGLBuffers();
 
         // Graphic fields
-        GL::Mesh _sphere{}, _poolCircle{NoCreate}, _cubeMesh{};
+        GL::Mesh _poolCircle{NoCreate};
         Color4 _clearColor = 0x002b36_rgbf;
         Color3 _pickColor = 0xffffff_rgbf;
 
         Shaders::Phong _phong_shader;
+        // Device spheres and address cubes
+        Figure::SelectableBatch *_device_batch;
+        Figure::SelectableBatch *_address_batch;
         Figure::ParaLineShader _line_shader;
+        Figure::PacketLineBatch *_packet_lines;
+        Figure::FlowEdgeShader _flow_shader;
+        Figure::FlowEdgeBatch *_flow_edges;
+
+        // Seconds since the current animation epoch as of the current
+        // frame, every transient animation computes its progress from it
+        Float _anim_clock{0.0f};
         Figure::PoolShader _pool_shader;
         Figure::WorldLinkShader _link_shader;
         Shaders::Flat3D _bbitem_shader;
@@ -736,11 +1041,175 @@ class Graphic {
 };
 
 
+/**
+ * @brief Bounded queue between exactly one producer and one consumer thread
+ *
+ * push and pop swap the item with the slot, so buffers owned by T go
+ * back and forth between the threads instead of being reallocated.
+ */
+template<typename T>
+class SpscQueue {
+    public:
+        explicit SpscQueue(size_t capacity): _slots(capacity) {}
+
+        bool push(T &item) {
+            size_t tail = _tail.load(std::memory_order_relaxed);
+            if (tail - _head.load(std::memory_order_acquire) == _slots.size()) {
+                return false;
+            }
+            std::swap(_slots[tail % _slots.size()], item);
+            _tail.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool pop(T &item) {
+            size_t head = _head.load(std::memory_order_relaxed);
+            if (head == _tail.load(std::memory_order_acquire)) {
+                return false;
+            }
+            std::swap(_slots[head % _slots.size()], item);
+            _head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        size_t size() const {
+            return _tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire);
+        }
+
+    private:
+        std::vector<T> _slots;
+        std::atomic<size_t> _head{0};
+        std::atomic<size_t> _tail{0};
+};
+
+/**
+ * @brief One scene update decoded from an epoch
+ *
+ * Devices are named by id or else by mac, see @ref WsBroker::findDevice.
+ */
+struct DrawCmd {
+    enum Kind: uint8_t {
+        // src_mac with src_id entered the network
+        ENTER_DEVICE,
+        // src sent cnt packets to dst
+        TRAFFIC,
+        // src sent cnt packets to the broadcast pool
+        POOL_HIT,
+        // src has the address ipv4
+        L3_ADDR,
+        // The arp table of src_mac holds dst
+        ARP_ROW,
+        // The epochs since the last EPOCH_END are complete, cnt[0] holds
+        // their number of rows
+        EPOCH_END
+    };
+
+    Kind kind;
+    uint8_t pool;
+    uint32_t src_id;
+    uint32_t dst_id;
+    uint32_t ipv4;
+    uint64_t src_mac;
+    uint64_t dst_mac;
+    // ipv4, ipv6, arp and unknown packets
+    uint32_t cnt[4];
+    // When the last epoch of an EPOCH_END arrived, see emscripten_get_now
+    double ingest_ms;
+};
+
+/**
+ * @brief What the sampler decided for one websocket message
+ *
+ * Announcements of devices and addresses are always drawn, only the
+ * traffic of an epoch is coalesced or skipped.
+ */
+struct FramePacing {
+    double ingest_ms{0};
+    // Traffic of this many epochs is summed before it is drawn
+    int coalesce{1};
+    bool skip{false};
+};
+
+/**
+ * @brief A websocket message waiting for the decoder thread
+ */
+struct WsFrame {
+    std::vector<uint8_t> data;
+    bool deflate{false};
+    FramePacing pacing;
+};
+
 class WsBroker {
     public:
         WsBroker(std::string ws_uri, Graphic *g, Store *s);
+        ~WsBroker();
 
-        void processEpochStep(epoch::EpochStep);
+        /**
+         * @brief Decodes one websocket message into draw commands
+         *
+         * Runs on the decoder thread in builds with pthreads and inside the
+         * websocket callback otherwise. Skipped epochs still update the rate
+         * table.
+         */
+        void decodeFrame(const uint8_t *data, size_t size, bool compressed, const FramePacing &pacing);
+
+        /**
+         * @brief Hands a copy of a websocket message to the decoder thread
+         *
+         * Messages are never dropped since deltas and announcements only
+         * arrive once. While the decoder queue is full they wait in order
+         * in frameBacklog.
+         */
+        void submitFrame(const uint8_t *data, size_t size, const FramePacing &pacing);
+
+        /**
+         * @brief Moves backlogged messages into the decoder queue
+         *
+         * Called for every new message and every frame on the main thread.
+         */
+        void flushFrames();
+
+        /**
+         * @brief Picks how the next epochs are paced from the measured lag
+         *
+         * Traffic is coalesced over more epochs while the lag or the queue
+         * grows and over fewer once both are back down. Called every frame.
+         */
+        void adaptPacing();
+
+        /**
+         * @brief Turns a parsed epoch into draw commands
+         */
+        void reduceEpochStep(const epoch::EpochStep &es);
+
+        /**
+         * @brief Reduces the rows of an epoch sent with ?layout=columnar
+         */
+        void reduceColumns(const epoch::L2Columns &cols);
+
+        /**
+         * @brief Applies queued draw commands to the scene for up to budget_ms
+         *
+         * Commands left over wait for the next frame. Only called from the
+         * main thread.
+         */
+        void applyCommands(double budget_ms);
+        void applyCommand(const DrawCmd &cmd);
+
+        /**
+         * @brief Applies a KEYFRAME or DELTA epoch to the rate table
+         *
+         * Afterwards the l2_dev_comm rows of es are the whole rate table so
+         * the epoch draws like a FULL one.
+         */
+        void applyRates(epoch::EpochStep *es);
+
+        /**
+         * @brief Finds a device by the id mux_server gave it or else by mac
+         *
+         * Returns nullptr for devices that were never announced.
+         */
+        Device::Stats* findDevice(uint64_t mac, uint32_t id);
 
         void statsGui();
 
@@ -762,10 +1231,14 @@ class WsBroker {
          */
         void closeSocket();
 
-        void parse_bcast_summaries(Context::Store *sCtx, Context::Graphic *gCtx, epoch::DeviceComm dComm, Device::Stats* tran_d_s);
-        void parse_single_mcast(Context::Store *sCtx, Context::Graphic *gCtx, std::string v, epoch::L2Summary l2sum, Device::Stats* tran_d_s);
-        void parse_enter_l3_addr(Context::Store *sCtx, Context::Graphic *gCtx, epoch::AddrAssoc addr_map);
-        void parse_arp_table(Context::Store *sCtx, Context::Graphic *gCtx, epoch::ArpAssoc arp_table);
+        void pushCommand(const DrawCmd &cmd);
+        void pushTraffic(const DrawCmd &cmd);
+        void flushTraffic(double ingest_ms);
+        // Flushes held traffic once the oldest epoch in it is lagHighMs old
+        void flushStaleTraffic();
+        void decodeLoop();
+
+        void enterDevice(uint64_t mac, uint32_t id);
 
         Graphic *gCtx;
         Store *sCtx;
@@ -774,7 +1247,54 @@ class WsBroker {
 
         bool socket_connected = false;
 
-        std::chrono::duration<int64_t, std::nano> curr_ws_lag;
+        // Set when the url asks mux_server for zlib compressed epochs
+        bool deflate = false;
+        std::string inflateBuf;
+
+        // Every message is parsed into this one so its rows stay allocated
+        epoch::EpochStep epochStep;
+
+        // Messages flow from the websocket callback to the decoder and
+        // come back as draw commands for the main thread
+        static const size_t commandCapacity = 1 << 16;
+        SpscQueue<WsFrame> frames{64};
+        SpscQueue<DrawCmd> commands{commandCapacity};
+
+        // Time each frame may spend applying draw commands
+        float applyBudgetMs{4.0f};
+        float applyMs{0.0f};
+
+        // Set by adaptPacing for every new message
+        FramePacing pacing;
+        double lastAdaptMs{0};
+        // When the last EPOCH_END was applied
+        double lastEpochEndMs{0};
+
+        // Lag above which traffic is coalesced more and below which less
+        static constexpr double lagHighMs = 250.0;
+        static constexpr double lagLowMs = 50.0;
+
+        // Traffic of coalesced epochs that is not queued yet, only touched
+        // by the decoder
+        typedef std::tuple<uint8_t, uint8_t, uint64_t, uint32_t, uint64_t, uint32_t> TrafficKey;
+        std::map<TrafficKey, DrawCmd> pendingTraffic;
+        FramePacing decodePacing;
+        int pendingEpochs{0};
+        // Ingest time of the oldest epoch in pendingTraffic
+        double pendingIngestMs{0};
+        uint32_t pendingRows{0};
+        std::atomic<int> tot_epoch_coalesced{0};
+        WsFrame frameBuf;
+        // Messages the full decoder queue could not take yet, main thread only
+        std::deque<WsFrame> frameBacklog;
+
+        std::thread decoder;
+        std::mutex frameLock;
+        std::condition_variable frameCond;
+        std::atomic<bool> stopDecoder{false};
+
+        // From receiving an epoch to applying its last draw command
+        std::chrono::duration<int64_t, std::nano> curr_ws_lag{0};
 
         // Custom ImGui interface components
         Device::ChartMgr ifaceChartMgr{240, 3.0f};
@@ -784,9 +1304,15 @@ class WsBroker {
         int tot_ws_drop{0};
         int tot_epoch_drop{0};
         int event_cnt{0};
+        // Events seen during the last whole second
+        int event_rate{0};
+        double eventWindowMs{0};
 
-        int inv_sample_rate{1};
         int epoch_packets_sum{0};
+
+        // Per pair rates of a mux_server opened with ?delta=1, keyed by
+        // src_id with the top bit set or else by mac_src
+        std::map<uint64_t, epoch::DeviceComm> rateTable;
 };
 
 } // Context
@@ -3,13 +3,134 @@
 using namespace Monopticon::Figure;
 
 
-DeviceDrawable::DeviceDrawable(UnsignedByte id, Object3D& object, Shaders::Phong& shader, Color3 &color, GL::Mesh& mesh, const Matrix4& primitiveTransformation, SceneGraph::DrawableGroup3D& drawables):
+SelectableInstance::SelectableInstance(SelectableBatch& batch, UnsignedInt id):
+    _batch{&batch},
+    _id{id}
+{
+    _batch->add(this);
+}
+
+
+SelectableInstance::~SelectableInstance() {
+    if (_batch != nullptr) {
+        _batch->remove(this);
+    }
+}
+
+
+SelectableBatch::SelectableBatch(Object3D& object, Shaders::Phong& shader, GL::Mesh&& mesh, const Color3& ambient, SceneGraph::DrawableGroup3D& group):
+    SceneGraph::Drawable3D{object, &group},
+    _shader{shader},
+    _mesh{std::move(mesh)},
+    _ambient{ambient}
+{
+    _mesh.setInstanceCount(0)
+         .addVertexBufferInstanced(_instanceBuffer, 1, 0,
+            Shaders::Phong::TransformationMatrix{},
+            Shaders::Phong::NormalMatrix{},
+            Shaders::Phong::Color3{},
+            Shaders::Phong::ObjectId{});
+}
+
+
+SelectableBatch::~SelectableBatch() {
+    for (SelectableInstance *member: _members) {
+        member->_batch = nullptr;
+    }
+}
+
+
+void SelectableBatch::add(SelectableInstance* member) {
+    member->_slot = _members.size();
+    _members.push_back(member);
+    _instances.push_back(Instance{});
+    markDirty(member->_slot);
+}
+
+
+void SelectableBatch::remove(SelectableInstance* member) {
+    const size_t i = member->_slot;
+
+    // Fill the hole with the last instance
+    if (i + 1 != _members.size()) {
+        _members[i] = _members.back();
+        _members[i]->_slot = i;
+        _instances[i] = _instances.back();
+        markDirty(i);
+    }
+    _members.pop_back();
+    _instances.pop_back();
+
+    _dirtyEnd = std::min(_dirtyEnd, _instances.size());
+    if (_dirtyBegin >= _dirtyEnd) {
+        _dirtyBegin = _dirtyEnd = 0;
+    }
+}
+
+
+void SelectableBatch::markDirty(size_t i) {
+    if (_dirtyBegin == _dirtyEnd) {
+        _dirtyBegin = i;
+        _dirtyEnd = i + 1;
+    } else {
+        _dirtyBegin = std::min(_dirtyBegin, i);
+        _dirtyEnd = std::max(_dirtyEnd, i + 1);
+    }
+}
+
+
+void SelectableBatch::draw(const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera) {
+    for (size_t i = 0; i < _members.size(); i++) {
+        SelectableInstance *member = _members[i];
+        Instance& instance = _instances[i];
+
+        const Matrix4 t = member->instanceTransformation();
+        const Color3 c = member->instanceColor();
+        // Ids start at 1 since 0 is the cleared object id framebuffer
+        const UnsignedInt id = member->objectId() + 1;
+        if (t == instance.transformation && c == instance.color && id == instance.objectId) {
+            continue;
+        }
+
+        instance = Instance{t, t.rotationScaling(), c, id};
+        markDirty(i);
+    }
+
+    if (_instances.size() > _bufferCapacity) {
+        _bufferCapacity = std::max<size_t>(2*_bufferCapacity, std::max<size_t>(_instances.size(), 64));
+        _instanceBuffer.setData({nullptr, _bufferCapacity*sizeof(Instance)}, GL::BufferUsage::DynamicDraw);
+        _dirtyBegin = 0;
+        _dirtyEnd = _instances.size();
+    }
+
+    if (_dirtyBegin != _dirtyEnd) {
+        _instanceBuffer.setSubData(_dirtyBegin*sizeof(Instance),
+            Containers::arrayView(_instances.data() + _dirtyBegin, _dirtyEnd - _dirtyBegin));
+        _dirtyBegin = _dirtyEnd = 0;
+    }
+    _mesh.setInstanceCount(_instances.size());
+
+    if (_instances.empty()) {
+        return;
+    }
+
+    // The instances hold world transformations, the uniforms add the camera
+    _shader.setTransformationMatrix(transformationMatrix)
+           .setNormalMatrix(transformationMatrix.rotationScaling())
+           .setProjectionMatrix(camera.projectionMatrix())
+           .setAmbientColor(_ambient)
+           .setDiffuseColor(0xffffff_rgbf)
+           /* relative to the camera */
+           .setLightPosition({0.0f, 4.0f, 3.0f})
+           .setObjectId(0);
+    _shader.draw(_mesh);
+}
+
+
+DeviceDrawable::DeviceDrawable(UnsignedInt id, Object3D& object, SelectableBatch& batch, Color3 &color, const Matrix4& primitiveTransformation):
     Object3D{&object},
-    SceneGraph::Drawable3D{object, &drawables},
-    _id{id},
+    SelectableInstance{batch, id},
     _color{color},
-    _shader(shader),
-    _mesh(mesh),
     _primitiveTransformation{primitiveTransformation},
     _t{1.0f} {}
 
@@ -19,24 +140,13 @@ void DeviceDrawable::resetTParam() {
 }
 
 
-void DeviceDrawable::draw(const Matrix4& transformation, SceneGraph::Camera3D& camera){
-    /*if (_drop) {
-        _t = _t - 0.01f;
-        if (_t < 0.0f) _drop = false;
-    } else {
-        _t = _t + 0.01f;
-        if (_t > 1.0f) _drop = true;
-    }*/
+Matrix4 DeviceDrawable::instanceTransformation() {
+    return absoluteTransformationMatrix()*_primitiveTransformation;
+}
 
-    _shader.setTransformationMatrix(transformation*_primitiveTransformation)
-           .setNormalMatrix(transformation.rotationScaling())
-           .setProjectionMatrix(camera.projectionMatrix())
-           .setAmbientColor(_deviceStats->_selected ? _color*0.2f : Color3{})
-           .setDiffuseColor(_color*(_deviceStats->_selected ? 1.5f : 0.9f))
-           /* relative to the camera */
-           .setLightPosition({0.0f, 4.0f, 3.0f})
-           .setObjectId(_id+1);
-    _shader.draw(_mesh);
+
+Color3 DeviceDrawable::instanceColor() {
+    return _color*(_deviceStats->_selected ? 1.5f : 0.9f);
 }
 
 
@@ -70,79 +180,299 @@ ParaLineShader::ParaLineShader() {
     frag.addSource(rs.get("src/shaders/packetline.fs"));
     CORRADE_INTERNAL_ASSERT(GL::Shader::compile({vert, frag}));
     attachShaders({vert, frag});
+
+    bindAttributeLocation(Endpoint::Location, "endpoint");
+    bindAttributeLocation(APos::Location, "aPos");
+    bindAttributeLocation(BPos::Location, "bPos");
+    bindAttributeLocation(Color::Location, "lineColor");
+    bindAttributeLocation(SpawnTime::Location, "spawnTime");
     CORRADE_INTERNAL_ASSERT(link());
 
-    _aPosUniform = uniformLocation("aPos");
-    _bPosUniform = uniformLocation("bPos");
-    _colorUniform = uniformLocation("color");
-    _tParamUniform = uniformLocation("tParam");
+    _timeUniform = uniformLocation("time");
     _transformationProjectionMatrixUniform = uniformLocation("transformationProjectionMatrix");
-
-    //CORRADE_INTERNAL_ASSERT(_bPosUniform >= 0);
 }
 
 
-ParaLineShader& ParaLineShader::setColor(const Color4& color) {
-    setUniform(_colorUniform, color);
+ParaLineShader& ParaLineShader::setTime(const float t) {
+    setUniform(_timeUniform, t);
     return *this;
 }
 
 
-ParaLineShader& ParaLineShader::setAPos(const Vector3& position) {
-    setUniform(_aPosUniform, position);
+ParaLineShader& ParaLineShader::setTransformationProjectionMatrix(const Matrix4& matrix) {
+    setUniform(_transformationProjectionMatrixUniform, matrix);
     return *this;
 }
 
 
-ParaLineShader& ParaLineShader::setBPos(const Vector3& position) {
-    setUniform(_bPosUniform, position);
-    return *this;
+PacketLineBatch::PacketLineBatch(Object3D& object, ParaLineShader& shader, SceneGraph::DrawableGroup3D& group, const Float& clock, UnsignedInt capacity):
+    SceneGraph::Drawable3D{object, &group},
+    _shader{shader},
+    _instances(capacity),
+    _clock{clock}
+{
+    const Float endpoints[]{0.0f, 1.0f};
+    _endpoints.setData(endpoints, GL::BufferUsage::StaticDraw);
+
+    _instanceBuffer.setData({nullptr, capacity*sizeof(Instance)}, GL::BufferUsage::DynamicDraw);
+
+    _mesh.setPrimitive(GL::MeshPrimitive::Lines)
+         .setCount(2)
+         .setInstanceCount(0)
+         .addVertexBuffer(_endpoints, 0, ParaLineShader::Endpoint{})
+         .addVertexBufferInstanced(_instanceBuffer, 1, 0,
+            ParaLineShader::APos{},
+            ParaLineShader::BPos{},
+            ParaLineShader::Color{},
+            ParaLineShader::SpawnTime{});
 }
 
 
-ParaLineShader& ParaLineShader::setTParam(const float t) {
-    setUniform(_tParamUniform, t);
+void PacketLineBatch::add(const Vector3& a, const Vector3& b, const Color4& c) {
+    _instances[_written % _instances.size()] = Instance{a, b, c, _clock*ANIMATION_RATE};
+    _written++;
+}
+
+
+void PacketLineBatch::clear() {
+    _written = 0;
+    _uploaded = 0;
+    _mesh.setInstanceCount(0);
+}
+
+
+void PacketLineBatch::rebase(Float by) {
+    const UnsignedLong n = _instances.size();
+    const UnsignedLong live = std::min<UnsignedLong>(_written, n);
+    for (UnsignedLong i = 0; i < live; i++) {
+        _instances[i].spawnTime -= by*ANIMATION_RATE;
+    }
+    // Upload every slot in use on the next draw
+    _uploaded = _written - live;
+}
+
+
+void PacketLineBatch::upload(UnsignedLong from, UnsignedLong to) {
+    const UnsignedLong n = _instances.size();
+    if (to - from >= n) {
+        _instanceBuffer.setSubData(0, Containers::arrayView(_instances.data(), n));
+        return;
+    }
+
+    std::size_t begin = from % n;
+    std::size_t end = to % n;
+    if (begin < end) {
+        _instanceBuffer.setSubData(begin*sizeof(Instance), Containers::arrayView(_instances.data() + begin, end - begin));
+    } else {
+        _instanceBuffer.setSubData(begin*sizeof(Instance), Containers::arrayView(_instances.data() + begin, n - begin));
+        _instanceBuffer.setSubData(0, Containers::arrayView(_instances.data(), end));
+    }
+}
+
+
+void PacketLineBatch::draw(const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera) {
+    if (_written == 0) {
+        return;
+    }
+
+    if (_written > _uploaded) {
+        upload(_uploaded, _written);
+        _uploaded = _written;
+        _mesh.setInstanceCount(std::min<UnsignedLong>(_written, _instances.size()));
+    }
+
+    _shader.setTransformationProjectionMatrix(camera.projectionMatrix()*transformationMatrix)
+           .setTime(_clock*ANIMATION_RATE);
+    _shader.draw(_mesh);
+}
+
+
+FlowEdgeShader::FlowEdgeShader() {
+    Utility::Resource rs("monopticon");
+
+    GL::Shader vert{GL::Version::GLES300, GL::Shader::Type::Vertex},
+        frag{GL::Version::GLES300, GL::Shader::Type::Fragment};
+    vert.addSource(rs.get("src/shaders/flowedge.vs"));
+    frag.addSource(rs.get("src/shaders/flowedge.fs"));
+    CORRADE_INTERNAL_ASSERT(GL::Shader::compile({vert, frag}));
+    attachShaders({vert, frag});
+
+    bindAttributeLocation(Along::Location, "along");
+    bindAttributeLocation(APos::Location, "aPos");
+    bindAttributeLocation(BPos::Location, "bPos");
+    bindAttributeLocation(Counts::Location, "counts");
+    bindAttributeLocation(LastSeen::Location, "lastSeen");
+    CORRADE_INTERNAL_ASSERT(link());
+
+    _timeUniform = uniformLocation("time");
+    _transformationProjectionMatrixUniform = uniformLocation("transformationProjectionMatrix");
+
+    // In the same order as the components of Counts
+    const Vector3 typeColors[]{
+        Util::typeColor(Util::L3Type::IPV4),
+        Util::typeColor(Util::L3Type::IPV6),
+        Util::typeColor(Util::L3Type::ARP),
+        Util::typeColor(Util::L3Type::UNKNOWN)
+    };
+    setUniform(uniformLocation("typeColors"), Containers::arrayView(typeColors));
+    setUniform(uniformLocation("decay"), FLOW_DECAY);
+    setUniform(uniformLocation("cutoff"), FLOW_CUTOFF);
+    setUniform(uniformLocation("pulseRate"), ANIMATION_RATE);
+}
+
+
+FlowEdgeShader& FlowEdgeShader::setTime(const float t) {
+    setUniform(_timeUniform, t);
     return *this;
 }
 
 
-ParaLineShader& ParaLineShader::setTransformationProjectionMatrix(const Matrix4& matrix) {
+FlowEdgeShader& FlowEdgeShader::setTransformationProjectionMatrix(const Matrix4& matrix) {
     setUniform(_transformationProjectionMatrixUniform, matrix);
     return *this;
 }
 
 
-PacketLineDrawable::PacketLineDrawable(Object3D& object, ParaLineShader& shader, Vector3& a, Vector3& b, SceneGraph::DrawableGroup3D& group, Color4 c):
+FlowEdgeBatch::FlowEdgeBatch(Object3D& object, FlowEdgeShader& shader, SceneGraph::DrawableGroup3D& group, const Float& clock, UnsignedInt capacity):
     SceneGraph::Drawable3D{object, &group},
-    _object{object},
     _shader{shader},
-    _a{a},
-    _b{b},
-    _c{c}
+    _capacity{capacity},
+    _clock{clock}
 {
-    _t = 0.0f;
-    // TODO more efficient to initialize in caller
-    _mesh = MeshTools::compile(Primitives::line3D(a,b));
-    _expired = false;
+    // The arc is a strip of segments so the pulses are interpolated along it
+    const UnsignedInt segments = 32;
+    std::vector<Float> along(segments + 1);
+    for (UnsignedInt i = 0; i <= segments; i++) {
+        along[i] = Float(i)/segments;
+    }
+    _along.setData(Containers::arrayView(along.data(), along.size()), GL::BufferUsage::StaticDraw);
+
+    _instanceBuffer.setData({nullptr, capacity*sizeof(Instance)}, GL::BufferUsage::DynamicDraw);
+
+    _instances.reserve(capacity);
+    _keys.reserve(capacity);
+
+    _mesh.setPrimitive(GL::MeshPrimitive::LineStrip)
+         .setCount(segments + 1)
+         .setInstanceCount(0)
+         .addVertexBuffer(_along, 0, FlowEdgeShader::Along{})
+         .addVertexBufferInstanced(_instanceBuffer, 1, 0,
+            FlowEdgeShader::APos{},
+            FlowEdgeShader::BPos{},
+            FlowEdgeShader::Counts{},
+            FlowEdgeShader::LastSeen{});
+}
+
+
+void FlowEdgeBatch::add(Key key, const Vector3& a, const Vector3& b, const Vector4& counts) {
+    auto search = _slots.find(key);
+    if (search == _slots.end()) {
+        if (_instances.size() == _capacity) {
+            sweep();
+        }
+        if (_instances.size() == _capacity) {
+            return;
+        }
+
+        search = _slots.emplace(key, UnsignedInt(_instances.size())).first;
+        _instances.push_back(Instance{a, b, Vector4{}, _clock});
+        _keys.push_back(key);
+    }
+
+    // Decay what the edge held to now, the same way the shader does
+    Instance& edge = _instances[search->second];
+    edge.counts = edge.counts*std::exp((edge.lastSeen - _clock)/FLOW_DECAY) + counts;
+    edge.lastSeen = _clock;
+    // Devices can be moved by a new layout
+    edge.a = a;
+    edge.b = b;
+
+    markDirty(search->second);
+}
+
+
+void FlowEdgeBatch::clear() {
+    _instances.clear();
+    _keys.clear();
+    _slots.clear();
+    _dirtyBegin = _dirtyEnd = 0;
+    _mesh.setInstanceCount(0);
 }
 
 
-void PacketLineDrawable::draw(const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera) {
-    if (_t <= 1.000f && _t >= 0.0f) {
-        _t += 0.04f;
-        //Vector3 v = Vector3{0.02f, 0, 0.02f};
-        //_object.translate(v);
+void FlowEdgeBatch::rebase(Float by) {
+    for (Instance& edge: _instances) {
+        edge.lastSeen -= by;
+    }
+    _lastSweep -= by;
+
+    if (!_instances.empty()) {
+        markDirty(0);
+        markDirty(_instances.size() - 1);
+    }
+}
+
+
+void FlowEdgeBatch::markDirty(size_t i) {
+    if (_dirtyBegin == _dirtyEnd) {
+        _dirtyBegin = i;
+        _dirtyEnd = i + 1;
+    } else {
+        _dirtyBegin = std::min(_dirtyBegin, i);
+        _dirtyEnd = std::max(_dirtyEnd, i + 1);
+    }
+}
+
+
+void FlowEdgeBatch::sweep() {
+    _lastSweep = _clock;
+
+    size_t i = 0;
+    while (i < _instances.size()) {
+        const Instance& edge = _instances[i];
+        const Vector4 now = edge.counts*std::exp((edge.lastSeen - _clock)/FLOW_DECAY);
+        if (now.sum() >= FLOW_CUTOFF) {
+            i++;
+            continue;
+        }
+
+        // Fill the hole with the last edge
+        _slots.erase(_keys[i]);
+        if (i + 1 != _instances.size()) {
+            _instances[i] = _instances.back();
+            _keys[i] = _keys.back();
+            _slots[_keys[i]] = UnsignedInt(i);
+            markDirty(i);
+        }
+        _instances.pop_back();
+        _keys.pop_back();
+    }
+
+    _dirtyEnd = std::min(_dirtyEnd, _instances.size());
+    if (_dirtyBegin >= _dirtyEnd) {
+        _dirtyBegin = _dirtyEnd = 0;
+    }
+}
+
+
+void FlowEdgeBatch::draw(const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera) {
+    if (_clock - _lastSweep > 1.0f) {
+        sweep();
+    }
+
+    if (_dirtyBegin != _dirtyEnd) {
+        _instanceBuffer.setSubData(_dirtyBegin*sizeof(Instance),
+            Containers::arrayView(_instances.data() + _dirtyBegin, _dirtyEnd - _dirtyBegin));
+        _dirtyBegin = _dirtyEnd = 0;
     }
-    if (_t > 1.0f) {
-        _expired=true;
+    _mesh.setInstanceCount(_instances.size());
+
+    if (_instances.empty()) {
         return;
     }
 
     _shader.setTransformationProjectionMatrix(camera.projectionMatrix()*transformationMatrix)
-           .setBPos(_b)
-           .setAPos(_a)
-           .setTParam(_t)
-           .setColor(_c);
+           .setTime(_clock);
     _shader.draw(_mesh);
 }
 
@@ -278,32 +608,58 @@ PoolShader& PoolShader::setTransformationProjectionMatrix(const Matrix4& matrix)
 }
 
 
-MulticastDrawable::MulticastDrawable(Object3D& object, Color3 c, Vector3& origin, PoolShader& shader, SceneGraph::DrawableGroup3D& group, GL::Mesh& mesh):
+MulticastDrawable::MulticastDrawable(Object3D& object, Vector3& origin, PoolShader& shader, SceneGraph::DrawableGroup3D& group, GL::Mesh& mesh, const Float& clock, size_t capacity):
     SceneGraph::Drawable3D{object, &group},
     _object{object},
-    expired{false},
     _shader{shader},
-    _c{c},
     _origin{origin},
-    _mesh{mesh}
-{
-    _t = -1.0f;
+    _mesh{mesh},
+    _hits{capacity},
+    _clock{clock}
+{}
+
+
+bool MulticastDrawable::add(Color3 c) {
+    Hit *hit = _hits.push();
+    if (hit == nullptr) {
+        return false;
+    }
+    hit->c = c;
+    hit->spawn = _clock;
+    return true;
 }
 
 
-void MulticastDrawable::draw(const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera) {
-    if (expired || _t > 1.4f) {
-        expired = true;
-        return;
+void MulticastDrawable::expire() {
+    while (_hits.size() > 0 && (_clock - _hits[0].spawn)*ANIMATION_RATE > 2.4f) {
+        _hits.pop();
     }
+}
+
+
+void MulticastDrawable::rebase(Float by) {
+    for (size_t i = 0; i < _hits.size(); i++) {
+        _hits[i].spawn -= by;
+    }
+}
 
-    _t += 0.04f;
 
+void MulticastDrawable::draw(const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera) {
     _shader.setTransformationProjectionMatrix(camera.projectionMatrix()*transformationMatrix)
-           .setOriginPos(_origin)
-           .setColor(_c)
-           .setTParam(_t);
-    _shader.draw(_mesh);
+           .setOriginPos(_origin);
+
+    for (size_t i = 0; i < _hits.size(); i++) {
+        const Hit &hit = _hits[i];
+        // A ring waits a while at the origin before it spreads
+        float t = (_clock - hit.spawn)*ANIMATION_RATE - 1.0f;
+        if (t > 1.4f) {
+            continue;
+        }
+
+        _shader.setColor(hit.c)
+               .setTParam(t);
+        _shader.draw(_mesh);
+    }
 }
 
 
@@ -3,32 +3,22 @@
 using namespace Monopticon::Level3;
 
 
-Address::Address(UnsignedByte id, Object3D& object, Shaders::Phong& shader, Color3 &color, GL::Mesh& mesh, SceneGraph::DrawableGroup3D& group):
+Address::Address(UnsignedInt id, Object3D& object, Monopticon::Figure::SelectableBatch& batch, Color3 &color):
     Object3D{&object},
-    SceneGraph::Drawable3D{object, &group},
-    _id{id},
-    _color{color},
-    _shader{shader},
-    _mesh{mesh}
+    SelectableInstance{batch, id},
+    _color{color}
 {
 
 }
 
 
-void Address::draw(const Matrix4& transformationMatrix, SceneGraph::Camera3D& camera) {
-    auto tm = transformationMatrix;
+Matrix4 Address::instanceTransformation() {
+    return absoluteTransformationMatrix();
+}
 
-    _shader.setTransformationMatrix(tm)
-           .setNormalMatrix(tm.rotationScaling())
-           .setProjectionMatrix(camera.projectionMatrix())
-           .setAmbientColor(_color*0.2)
-           //.setTimeIntensity(1.0)
-           .setDiffuseColor(_color)
-           /* relative to the camera */
-           .setLightPosition({0.0f, 4.0f, 3.0f})
-           .setObjectId(_id+1);
 
-    _shader.draw(_mesh);
+Color3 Address::instanceColor() {
+    return _color;
 }
 
 
@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <cstdio>
+
+#include "mac_index.h"
+
+namespace Monopticon { namespace Util {
+
+std::string fmtEUI48(const uint64_t & mac) {
+    const uint8_t* cmac = reinterpret_cast<const uint8_t *>(&mac);
+    char buf[20];
+    snprintf(buf, sizeof buf, "%02x:%02x:%02x:%02x:%02x:%02x",
+        *cmac, *(cmac+1), *(cmac+2), *(cmac+3), *(cmac+4), *(cmac+5));
+
+    return std::string(buf);
+}
+
+uint64_t parseEUI48(const std::string & s) {
+    if (s.size() != 17) {
+        return MAC_NONE;
+    }
+
+    uint64_t mac = 0;
+    for (int i = 0; i < 6; i++) {
+        if (i > 0 && s[i*3 - 1] != ':') {
+            return MAC_NONE;
+        }
+
+        uint64_t byte = 0;
+        for (int j = 0; j < 2; j++) {
+            char c = s[i*3 + j];
+            byte <<= 4;
+            if (c >= '0' && c <= '9') {
+                byte |= c - '0';
+            } else if (c >= 'a' && c <= 'f') {
+                byte |= c - 'a' + 10;
+            } else if (c >= 'A' && c <= 'F') {
+                byte |= c - 'A' + 10;
+            } else {
+                return MAC_NONE;
+            }
+        }
+        // fmtEUI48 prints the bytes in memory order
+        mac |= byte << (8*i);
+    }
+    return mac;
+}
+
+}}
+
+namespace Monopticon { namespace Context {
+
+MacIndex::MacIndex():
+    _slots(16, Slot{Util::MAC_NONE, NONE}),
+    _shift(64 - 4)
+{
+}
+
+uint32_t MacIndex::find(uint64_t mac) const
+{
+    size_t mask = _slots.size() - 1;
+    for (size_t i = home(mac); ; i = (i + 1) & mask) {
+        const Slot &s = _slots[i];
+        if (s.mac == mac) {
+            return s.index;
+        }
+        if (s.mac == Util::MAC_NONE) {
+            return NONE;
+        }
+    }
+}
+
+void MacIndex::insert(uint64_t mac, uint32_t index)
+{
+    if ((_size + 1) * 2 > _slots.size()) {
+        grow();
+    }
+
+    size_t mask = _slots.size() - 1;
+    for (size_t i = home(mac); ; i = (i + 1) & mask) {
+        Slot &s = _slots[i];
+        if (s.mac == mac) {
+            s.index = index;
+            return;
+        }
+        if (s.mac == Util::MAC_NONE) {
+            s = Slot{mac, index};
+            _size++;
+            return;
+        }
+    }
+}
+
+void MacIndex::grow()
+{
+    std::vector<Slot> old(_slots.size() * 2, Slot{Util::MAC_NONE, NONE});
+    old.swap(_slots);
+    _shift -= 1;
+    _size = 0;
+
+    for (auto it = old.begin(); it != old.end(); it++) {
+        if (it->mac != Util::MAC_NONE) {
+            insert(it->mac, it->index);
+        }
+    }
+}
+
+void MacIndex::clear()
+{
+    std::fill(_slots.begin(), _slots.end(), Slot{Util::MAC_NONE, NONE});
+    _size = 0;
+}
+
+}}
@@ -0,0 +1,72 @@
+#ifndef _INCL_mac_index
+#define _INCL_mac_index
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*
+ * Macs and the index Store finds devices by. Nothing here needs GL or
+ * emscripten so src/bench builds it for the host.
+ */
+namespace Monopticon {
+
+namespace Util {
+    /*
+     * Converts a mac to a string
+     */
+    std::string fmtEUI48(const uint64_t & mac);
+
+    /*
+     * Converts a mac string as written by fmtEUI48 back to a mac. Returns
+     * MAC_NONE for anything else.
+     */
+    uint64_t parseEUI48(const std::string & s);
+
+    // Macs only use 48 bits so this is never a real one
+    const uint64_t MAC_NONE = UINT64_MAX;
+}
+
+namespace Context {
+
+/**
+ * @brief Open addressing hash from a mac to the index of its device
+ *
+ * Linear probing over a power of two table kept at most half full.
+ * Empty slots hold Util::MAC_NONE. Lookups never allocate.
+ */
+class MacIndex {
+    public:
+        static const uint32_t NONE = UINT32_MAX;
+
+        MacIndex();
+
+        // Returns NONE for macs that were never inserted
+        uint32_t find(uint64_t mac) const;
+        void insert(uint64_t mac, uint32_t index);
+        void clear();
+
+        size_t size() const { return _size; }
+
+    private:
+        struct Slot {
+            uint64_t mac;
+            uint32_t index;
+        };
+
+        size_t home(uint64_t mac) const {
+            return (mac * 0x9e3779b97f4a7c15ull) >> _shift;
+        }
+        void grow();
+
+        std::vector<Slot> _slots;
+        int _shift;
+        size_t _size{0};
+};
+
+} // Context
+
+} // Monopticon
+
+#endif
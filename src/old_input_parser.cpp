@@ -181,13 +181,7 @@ int BrokerCtx::parse_epoch_step(Context::Store *sCtx, Context::Graphic *gCtx, br
             }
             Util::L2Summary struct_l2 = Util::parseL2Summary(l2summary);
 
-            Vector3 p1 = tran_d_s->circPoint;
-            Vector3 p2 = recv_d_s->circPoint;
-
-            gCtx->createLines(sCtx, p1, p2, Util::L3Type::IPV4, struct_l2.ipv4_cnt);
-            gCtx->createLines(sCtx, p1, p2, Util::L3Type::IPV6, struct_l2.ipv6_cnt);
-            gCtx->createLines(sCtx, p1, p2, Util::L3Type::ARP, struct_l2.arp_cnt);
-            gCtx->createLines(sCtx, p1, p2, Util::L3Type::UNKNOWN, struct_l2.unknown_cnt);
+            gCtx->addFlow(tran_d_s, recv_d_s, Vector4(struct_l2.ipv4_cnt, struct_l2.ipv6_cnt, struct_l2.arp_cnt, struct_l2.unknown_cnt));
             int dev_tot = Util::SumTotal(struct_l2);
             tran_d_s->num_pkts_sent += dev_tot;
             recv_d_s->num_pkts_recv += dev_tot;
@@ -85,6 +85,12 @@ launch() {
       broker_port=$3
     fi
 
+    # Optional name used to tell this sensor apart from others on one mux_server
+    sensor_redef=""
+    if [ -n "$4" ]
+    then
+      sensor_redef="redef sensor_id = \"$4\";"
+    fi
 
 
     # Check if ZEEK_ROOT is set, otherwise use the default package install path
@@ -99,7 +105,7 @@ launch() {
 
     if [ "$ext_endpoint" = true ]
     then
-      $zeek_bin_path -e "redef mux_server = \"${broker_host}\"; redef mux_server_port = ${broker_port}/tcp;" \
+      $zeek_bin_path -e "redef mux_server = \"${broker_host}\"; redef mux_server_port = ${broker_port}/tcp; ${sensor_redef}" \
                      -i $iface -b $script_path >monopticon.log &
     else
       $zeek_bin_path -i $iface -b $script_path >monopticon.log &
@@ -131,7 +137,7 @@ function contains() {
 function usage() {
     echo "USAGE: monopt_iface_proto FUNC"
     echo "FUNC:="
-    echo "     {launch <iface> [monopt_host] [port]}"
+    echo "     {launch <iface> [monopt_host] [port] [sensor_id]}"
     echo "     {sstop <pid>}"
     echo "     {list_ifaces}"
     echo "     {mac_addr <iface>}"
@@ -0,0 +1,17 @@
+uniform highp float time;
+uniform highp float pulseRate;
+
+in highp float vAlong;
+flat in highp float pulses;
+flat in lowp vec4 color;
+
+out highp vec4 fragmentColor;
+
+void main() {
+    // Pulses cross the arc as fast as packet lines do, busier edges
+    // carry more of them at once
+    highp float phase = fract((vAlong - time*pulseRate)*pulses);
+    lowp float pulse = smoothstep(0.85, 1.0, phase);
+
+    fragmentColor = vec4(color.rgb, color.a*(0.35 + 0.65*pulse));
+}
@@ -0,0 +1,53 @@
+precision highp float;
+
+uniform highp mat4 transformationProjectionMatrix;
+uniform highp float time;
+uniform highp float decay;
+uniform highp float cutoff;
+uniform lowp vec3 typeColors[4];
+
+in highp float along;
+
+// Per instance
+in highp vec3 aPos;
+in highp vec3 bPos;
+in highp vec4 counts;
+in highp float lastSeen;
+
+out highp float vAlong;
+flat out highp float pulses;
+flat out lowp vec4 color;
+
+vec3 calc_pos(vec3 a, vec3 b, float t) {
+    vec3 c = a + (b - a)/2.0 + vec3(0.0, 4.0, 0.0);
+
+    vec3 pos = (1.0-t)*((1.0-t)*a + t*c) + t*((1.0-t)*c + t*b);
+
+    return pos;
+}
+
+
+void main() {
+    vec4 now = counts*exp((lastSeen - time)/decay);
+    float total = now.x + now.y + now.z + now.w;
+
+    vAlong = along;
+
+    // Idle edges collapse outside the clip volume until they are swept
+    if (total < cutoff) {
+        gl_Position = vec4(2.0, 2.0, 2.0, 1.0);
+        pulses = 0.0;
+        color = vec4(0.0);
+        return;
+    }
+
+    // A steady rate r settles at r*decay packets
+    float level = log2(1.0 + total/decay);
+
+    vec3 c = (now.x*typeColors[0] + now.y*typeColors[1] +
+              now.z*typeColors[2] + now.w*typeColors[3])/total;
+    color = vec4(c, clamp(0.2 + level/10.0, 0.2, 1.0));
+    pulses = 1.0 + floor(min(level, 7.0));
+
+    gl_Position = transformationProjectionMatrix*vec4(calc_pos(aPos, bPos, along), 1.0);
+}
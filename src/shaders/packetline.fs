@@ -1,7 +1,7 @@
-uniform lowp vec4 color;
+in lowp vec4 color;
 
 out highp vec4 fragmentColor;
 
 void main() {
-    fragmentColor = vec4(color);
+    fragmentColor = color;
 }
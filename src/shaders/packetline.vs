@@ -1,11 +1,17 @@
 precision highp float;
 
 uniform highp mat4 transformationProjectionMatrix;
-uniform highp vec3 aPos;
-uniform highp vec3 bPos;
-uniform lowp float tParam;
+uniform highp float time;
 
-in highp vec4 position;
+in highp float endpoint;
+
+// Per instance
+in highp vec3 aPos;
+in highp vec3 bPos;
+in lowp vec4 lineColor;
+in highp float spawnTime;
+
+out lowp vec4 color;
 
 vec3 calc_pos(vec3 a, vec3 b, float t) {
     vec3 c = a + (b - a)/2.0 + vec3(0.0, 4.0, 0.0);
@@ -17,18 +23,18 @@ vec3 calc_pos(vec3 a, vec3 b, float t) {
 
 
 void main() {
-    vec3 n_pos = position.xyz;
-    float d1 = distance(n_pos, aPos);
-    float d2 = distance(n_pos, bPos);
-
-    vec4 choice;
-    if (d1 > d2) {
-        choice = vec4(calc_pos(aPos, bPos, tParam), 1.0);
-    } else {
-        float t2 = tParam + 0.03;
-        choice = vec4(calc_pos(aPos, bPos, t2), 1.0);
+    float tParam = time - spawnTime;
+
+    // Lines that are done or not started yet collapse outside the clip volume
+    if (tParam <= 0.0 || tParam > 1.0) {
+        gl_Position = vec4(2.0, 2.0, 2.0, 1.0);
+        color = lineColor;
+        return;
     }
 
+    // The sender end of the short segment runs a little ahead of the other
+    float t = tParam + 0.03*(1.0 - endpoint);
 
-    gl_Position = transformationProjectionMatrix*choice;
+    gl_Position = transformationProjectionMatrix*vec4(calc_pos(aPos, bPos, t), 1.0);
+    color = lineColor;
 }
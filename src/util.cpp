@@ -2,16 +2,7 @@
 
 namespace Monopticon { namespace Util {
 
-std::string fmtEUI48(const uint64_t & mac) {
-    const uint8_t* cmac = reinterpret_cast<const uint8_t *>(&mac);
-    char buf[20];
-    snprintf(buf, sizeof buf, "%02x:%02x:%02x:%02x:%02x:%02x",
-        *cmac, *(cmac+1), *(cmac+2), *(cmac+3), *(cmac+4), *(cmac+5));
-
-    return std::string(buf);
-}
-
-int SumTotal(epoch::L2Summary struct_l2) {
+int SumTotal(const epoch::L2Summary &struct_l2) {
     return struct_l2.ipv4() + struct_l2.ipv6() + struct_l2.arp() + struct_l2.unknown();
 }
 
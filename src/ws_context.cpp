@@ -2,20 +2,6 @@
 
 namespace Monopticon { namespace Context {
 
-struct membuf: std::streambuf {
-    membuf(uint8_t* base, size_t size) {
-        char* p(reinterpret_cast<char*>(base));
-        this->setg(p, p, p + size);
-    }
-};
-
-struct imemstream: virtual membuf, std::istream {
-    imemstream(uint8_t * base, size_t size)
-        : membuf(base, size)
-        , std::istream(static_cast<std::streambuf*>(this)) {
-    }
-};
-
 static EM_BOOL WebSocketOpen(int eventType, const EmscriptenWebSocketOpenEvent *e, void *userData)
 {
     Context::WsBroker *b = static_cast<Context::WsBroker*>(userData);
@@ -39,6 +25,37 @@ static EM_BOOL WebSocketError(int eventType, const EmscriptenWebSocketErrorEvent
 }
 
 
+/*
+ * Inflates a zlib stream into out, reusing its capacity between epochs.
+ */
+static bool inflateEpoch(const uint8_t *data, size_t size, std::string *out) {
+    z_stream zs = z_stream();
+    if (inflateInit(&zs) != Z_OK) {
+        return false;
+    }
+
+    zs.next_in = const_cast<Bytef*>(data);
+    zs.avail_in = size;
+
+    out->resize(std::max(out->capacity(), size * 4));
+    size_t have = 0;
+    int ret;
+    do {
+        if (have == out->size()) {
+            out->resize(out->size() * 2);
+        }
+        zs.next_out = reinterpret_cast<Bytef*>(&(*out)[have]);
+        zs.avail_out = out->size() - have;
+        ret = inflate(&zs, Z_NO_FLUSH);
+        have = out->size() - zs.avail_out;
+    } while (ret == Z_OK);
+
+    inflateEnd(&zs);
+    out->resize(have);
+    return ret == Z_STREAM_END;
+}
+
+
 static EM_BOOL WebSocketMessage(int eventType, const EmscriptenWebSocketMessageEvent *e, void *userData)
 {
     if (e->isText) {
@@ -49,163 +66,551 @@ static EM_BOOL WebSocketMessage(int eventType, const EmscriptenWebSocketMessageE
 
     b->event_cnt += 1;
 
-    if (b->event_cnt % b->inv_sample_rate == 0) {
-        imemstream in(e->data, e->numBytes);
-        epoch::EpochStep es;
-
-        es.ParseFromIstream(&in);
-        b->processEpochStep(es);
-        
-        es.Clear();
-    } else {
+    FramePacing pacing = b->pacing;
+    pacing.ingest_ms = emscripten_get_now();
+    if (pacing.skip) {
         b->tot_epoch_drop += 1;
     }
 
-    if (b->event_cnt % 16 == 0 && b->inv_sample_rate <= 16) {
-        b->inv_sample_rate = b->inv_sample_rate*2;
-    }
+#ifdef __EMSCRIPTEN_PTHREADS__
+    b->submitFrame(e->data, e->numBytes, pacing);
+#else
+    b->decodeFrame(e->data, e->numBytes, b->deflate, pacing);
+#endif
 
     return 0;
 }
 
-void WsBroker::processEpochStep(epoch::EpochStep es) {
-    for (int j = 0; j < es.enter_l2devices_size(); j++) {
-         const uint64_t enter_mac  = es.enter_l2devices(j);
-         std::string mac_src = Util::fmtEUI48(enter_mac);
 
-         // If the mac_src is not already in the _device_map create a new device.
-         // This means that a frame with a never before seen source MAC creates a new Device.
-         auto search = sCtx->_device_map.find(mac_src);
-         if (search == sCtx->_device_map.end()) {
-             Device::Stats *d_s = gCtx->createSphere(sCtx, mac_src);
-             sCtx->_device_map.insert(std::make_pair(mac_src, d_s));
-             gCtx->addDirectLabels(d_s, mac_src);
-         }
+void WsBroker::submitFrame(const uint8_t *data, size_t size, const FramePacing &pacing) {
+    frameBuf.data.assign(data, data + size);
+    frameBuf.deflate = deflate;
+    frameBuf.pacing = pacing;
+
+    // Later messages queue behind the backlog to keep their order
+    if (!frameBacklog.empty() || !frames.push(frameBuf)) {
+        frameBacklog.push_back(std::move(frameBuf));
+        frameBuf = WsFrame{};
+        flushFrames();
+        return;
     }
 
-    int pkt_tot = 0;
+    // Taking the lock keeps the wakeup from slipping in before the wait
+    { std::lock_guard<std::mutex> guard(frameLock); }
+    frameCond.notify_one();
+}
 
-    for (int i = 0; i < es.l2_dev_comm_size(); i++) {
-        const epoch::DeviceComm devComm = es.l2_dev_comm(i);
-        uint64_t mac = devComm.mac_src();
-        std::string mac_src = Util::fmtEUI48(mac);
 
-        Device::Stats *tran_d_s;
-        auto search = sCtx->_device_map.find(mac_src);
-        if (search != sCtx->_device_map.end()) {
-            tran_d_s = search->second;
-        } else {
-            std::cerr << "tran_d_s not found! " << mac_src << std::endl;
+void WsBroker::flushFrames() {
+    bool pushed = false;
+    while (!frameBacklog.empty() && frames.push(frameBacklog.front())) {
+        frameBacklog.pop_front();
+        pushed = true;
+    }
+
+    if (pushed) {
+        { std::lock_guard<std::mutex> guard(frameLock); }
+        frameCond.notify_one();
+    }
+}
+
+
+void WsBroker::decodeLoop() {
+    WsFrame f;
+    while (!stopDecoder) {
+        if (!frames.pop(f)) {
+            // Wake up now and then so held traffic goes out when the stream pauses
+            std::unique_lock<std::mutex> lock(frameLock);
+            frameCond.wait_for(lock, std::chrono::milliseconds(50),
+                               [this] { return stopDecoder || frames.size() > 0; });
+            flushStaleTraffic();
             continue;
         }
+        decodeFrame(f.data.data(), f.data.size(), f.deflate, f.pacing);
+    }
+}
 
-        parse_bcast_summaries(sCtx, gCtx, devComm, tran_d_s);
 
-        for (int k = 0; k < devComm.tx_summary_size(); k++) {
-            epoch::L2Summary l2sum = devComm.tx_summary(k);
-            std::string mac_dst = Util::fmtEUI48(l2sum.mac_dst());
+void WsBroker::decodeFrame(const uint8_t *data, size_t size, bool compressed, const FramePacing &pacing) {
+    epoch::EpochStep &es = epochStep;
+    bool ok;
+    if (compressed) {
+        if (!inflateEpoch(data, size, &inflateBuf)) {
+            std::cerr << "WS bad deflate stream" << std::endl;
+            return;
+        }
+        ok = es.ParseFromArray(inflateBuf.data(), inflateBuf.size());
+    } else {
+        ok = es.ParseFromArray(data, size);
+    }
+    if (!ok) {
+        std::cerr << "WS bad epoch of " << size << " bytes" << std::endl;
+        return;
+    }
 
-            Device::Stats *recv_d_s;
-            auto search = sCtx->_device_map.find(mac_dst);
-            if (search != sCtx->_device_map.end()) {
-                recv_d_s = search->second;
-            } else {
-                std::cerr << "recv_d_s not found! " << mac_dst << std::endl;
-                continue;
-            }
+    // The rate table has to see every keyframe and delta, sampled or not
+    if (es.encoding() != epoch::FULL) {
+        applyRates(&es);
+    }
+
+    decodePacing = pacing;
+    reduceEpochStep(es);
+}
+
+
+void WsBroker::pushCommand(const DrawCmd &cmd) {
+    DrawCmd c = cmd;
+    while (!commands.push(c)) {
+#ifdef __EMSCRIPTEN_PTHREADS__
+        // The main thread drains the queue every frame
+        if (stopDecoder) {
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+#else
+        applyCommands(applyBudgetMs);
+#endif
+    }
+}
+
+
+void WsBroker::pushTraffic(const DrawCmd &cmd) {
+    if (decodePacing.skip) {
+        return;
+    }
+    if (decodePacing.coalesce <= 1 && pendingTraffic.empty()) {
+        pushCommand(cmd);
+        return;
+    }
 
-            Vector3 p1 = tran_d_s->circPoint;
-            Vector3 p2 = recv_d_s->circPoint;
+    TrafficKey key = std::make_tuple(cmd.kind, cmd.pool, cmd.src_mac, cmd.src_id, cmd.dst_mac, cmd.dst_id);
+    auto search = pendingTraffic.find(key);
+    if (search == pendingTraffic.end()) {
+        pendingTraffic.insert(std::make_pair(key, cmd));
+        return;
+    }
+    for (int i = 0; i < 4; i++) {
+        search->second.cnt[i] += cmd.cnt[i];
+    }
+}
 
-            gCtx->createLines(sCtx, p1, p2, Util::L3Type::IPV4, l2sum.ipv4());
-            gCtx->createLines(sCtx, p1, p2, Util::L3Type::IPV6, l2sum.ipv6());
-            gCtx->createLines(sCtx, p1, p2, Util::L3Type::ARP, l2sum.arp());
-            gCtx->createLines(sCtx, p1, p2, Util::L3Type::UNKNOWN, l2sum.unknown());
-            int dev_tot = Util::SumTotal(l2sum);
-            tran_d_s->num_pkts_sent += dev_tot;
-            recv_d_s->num_pkts_recv += dev_tot;
 
-            pkt_tot += dev_tot;
+void WsBroker::flushStaleTraffic() {
+    if (pendingEpochs > 0 && emscripten_get_now() - pendingIngestMs > lagHighMs) {
+        flushTraffic(pendingIngestMs);
+    }
+}
+
+
+void WsBroker::flushTraffic(double ingest_ms) {
+    for (auto it = pendingTraffic.begin(); it != pendingTraffic.end(); it++) {
+        pushCommand(it->second);
+    }
+    pendingTraffic.clear();
+
+    DrawCmd cmd = DrawCmd();
+    cmd.kind = DrawCmd::EPOCH_END;
+    cmd.cnt[0] = pendingRows;
+    cmd.ingest_ms = ingest_ms;
+    pushCommand(cmd);
+
+    tot_epoch_coalesced += pendingEpochs - 1;
+    pendingEpochs = 0;
+    pendingRows = 0;
+}
+
+
+Device::Stats* WsBroker::findDevice(uint64_t mac, uint32_t id) {
+    if (id != 0) {
+        if (id < sCtx->_device_ids.size()) {
+            return sCtx->_device_ids[id];
         }
+        return nullptr;
+    }
+
+    return sCtx->findDevice(mac);
+}
+
+
+static void setCounts(DrawCmd *cmd, const epoch::L2Summary &l2sum) {
+    cmd->cnt[0] = l2sum.ipv4();
+    cmd->cnt[1] = l2sum.ipv6();
+    cmd->cnt[2] = l2sum.arp();
+    cmd->cnt[3] = l2sum.unknown();
+}
+
+
+void WsBroker::reduceEpochStep(const epoch::EpochStep &es) {
+    bool has_ids = es.enter_l2device_ids_size() == es.enter_l2devices_size();
+
+    // Rate tables replace each other rather than add up
+    if (es.encoding() != epoch::FULL) {
+        pendingTraffic.clear();
+        pendingRows = 0;
+    }
+
+    DrawCmd cmd;
+    for (int j = 0; j < es.enter_l2devices_size(); j++) {
+        cmd = DrawCmd();
+        cmd.kind = DrawCmd::ENTER_DEVICE;
+        cmd.src_mac = es.enter_l2devices(j);
+        cmd.src_id = has_ids ? es.enter_l2device_ids(j) : 0;
+        pushCommand(cmd);
+    }
+
+    for (int i = 0; i < es.l2_dev_comm_size(); i++) {
+        const epoch::DeviceComm &devComm = es.l2_dev_comm(i);
+
+        const epoch::L2Summary *pools[4] = {
+            &devComm.bcast_33(), &devComm.bcast_ff(), &devComm.bcast_01(), &devComm.bcast_xx()
+        };
+        for (int p = 0; p < 4; p++) {
+            if (Util::SumTotal(*pools[p]) == 0) {
+                continue;
+            }
+            cmd = DrawCmd();
+            cmd.kind = DrawCmd::POOL_HIT;
+            cmd.pool = p;
+            cmd.src_mac = devComm.mac_src();
+            cmd.src_id = devComm.src_id();
+            setCounts(&cmd, *pools[p]);
+            pushTraffic(cmd);
+        }
+
+        for (int k = 0; k < devComm.tx_summary_size(); k++) {
+            const epoch::L2Summary &l2sum = devComm.tx_summary(k);
+
+            cmd = DrawCmd();
+            cmd.kind = DrawCmd::TRAFFIC;
+            cmd.src_mac = devComm.mac_src();
+            cmd.src_id = devComm.src_id();
+            cmd.dst_mac = l2sum.mac_dst();
+            cmd.dst_id = l2sum.dst_id();
+            setCounts(&cmd, l2sum);
+            pushTraffic(cmd);
+        }
+    }
+
+    if (es.has_l2_columns()) {
+        reduceColumns(es.l2_columns());
     }
 
     for (int m = 0; m < es.enter_l2_ipv4_addr_src_size(); m++) {
-        parse_enter_l3_addr(sCtx, gCtx, es.enter_l2_ipv4_addr_src(m));
+        const epoch::AddrAssoc &addr = es.enter_l2_ipv4_addr_src(m);
+
+        cmd = DrawCmd();
+        cmd.kind = DrawCmd::L3_ADDR;
+        cmd.src_mac = addr.mac_src();
+        cmd.src_id = addr.id();
+        cmd.ipv4 = addr.ipv4();
+        pushCommand(cmd);
     }
 
     for (int p = 0; p < es.enter_arp_table_size(); p++) {
-        parse_arp_table(sCtx, gCtx, es.enter_arp_table(p));
+        const epoch::ArpAssoc &arp_table = es.enter_arp_table(p);
+
+        for (int j = 0; j < arp_table.table_row_size(); j++) {
+            const epoch::AddrAssoc &row = arp_table.table_row(j);
+
+            cmd = DrawCmd();
+            cmd.kind = DrawCmd::ARP_ROW;
+            cmd.src_mac = arp_table.mac_src();
+            cmd.dst_mac = row.mac_src();
+            cmd.dst_id = row.id();
+            cmd.ipv4 = row.ipv4();
+            pushCommand(cmd);
+        }
+    }
+
+    pendingRows += es.l2_dev_comm_size() + es.l2_columns().src_id_size();
+    if (pendingEpochs == 0) {
+        pendingIngestMs = decodePacing.ingest_ms;
     }
+    pendingEpochs += 1;
 
-    epoch_packets_sum += es.l2_dev_comm_size();
+    // The lag is measured from the oldest epoch held, which is also never
+    // held for longer than lagHighMs
+    if (pendingEpochs >= decodePacing.coalesce || emscripten_get_now() - pendingIngestMs > lagHighMs) {
+        flushTraffic(pendingIngestMs);
+    }
 }
 
 
-void WsBroker::parse_bcast_summaries(Context::Store *sCtx, Context::Graphic *gCtx, epoch::DeviceComm dComm, Device::Stats* tran_d_s) {
-    parse_single_mcast(sCtx, gCtx, "33", dComm.bcast_33(), tran_d_s);
-    parse_single_mcast(sCtx, gCtx, "ff", dComm.bcast_ff(), tran_d_s);
-    parse_single_mcast(sCtx, gCtx, "01", dComm.bcast_01(), tran_d_s);
-    parse_single_mcast(sCtx, gCtx, "odd", dComm.bcast_xx(), tran_d_s);
+void WsBroker::reduceColumns(const epoch::L2Columns &cols) {
+    const int n = cols.src_id_size();
+    const uint32_t *src = cols.src_id().data();
+    const uint32_t *dst = cols.dst_id().data();
+    const uint32_t *ipv4 = cols.ipv4().data();
+    const uint32_t *ipv6 = cols.ipv6().data();
+    const uint32_t *arp = cols.arp().data();
+    const uint32_t *unknown = cols.unknown().data();
+
+    // mux_server always fills every column, anything else is a bad frame
+    if (cols.dst_id_size() != n || cols.ipv4_size() != n || cols.ipv6_size() != n ||
+        cols.arp_size() != n || cols.unknown_size() != n) {
+        std::cerr << "l2_columns lengths differ" << std::endl;
+        return;
+    }
+
+    DrawCmd cmd = DrawCmd();
+    cmd.kind = DrawCmd::TRAFFIC;
+    for (int i = 0; i < n; i++) {
+        cmd.src_id = src[i];
+        cmd.dst_id = dst[i];
+        cmd.cnt[0] = ipv4[i];
+        cmd.cnt[1] = ipv6[i];
+        cmd.cnt[2] = arp[i];
+        cmd.cnt[3] = unknown[i];
+        pushTraffic(cmd);
+    }
+
+    const int m = cols.bcast_src_id_size();
+    if (cols.bcast_pool_size() != m || cols.bcast_ipv4_size() != m || cols.bcast_ipv6_size() != m ||
+        cols.bcast_arp_size() != m || cols.bcast_unknown_size() != m) {
+        std::cerr << "l2_columns bcast lengths differ" << std::endl;
+        return;
+    }
+
+    cmd = DrawCmd();
+    cmd.kind = DrawCmd::POOL_HIT;
+    for (int i = 0; i < m; i++) {
+        if (cols.bcast_pool(i) > 3) {
+            continue;
+        }
+        cmd.pool = cols.bcast_pool(i);
+        cmd.src_id = cols.bcast_src_id(i);
+        cmd.cnt[0] = cols.bcast_ipv4(i);
+        cmd.cnt[1] = cols.bcast_ipv6(i);
+        cmd.cnt[2] = cols.bcast_arp(i);
+        cmd.cnt[3] = cols.bcast_unknown(i);
+        pushTraffic(cmd);
+    }
 }
 
 
-void WsBroker::parse_single_mcast(Context::Store *sCtx, Context::Graphic *gCtx, std::string v, epoch::L2Summary l2sum, Device::Stats* tran_d_s) {
-    Device::PrefixStats* dp_s = sCtx->_dst_prefix_group_map.at(v);
-    gCtx->createPoolHits(sCtx, tran_d_s, dp_s, l2sum);
+void WsBroker::applyCommands(double budget_ms) {
+    double start = emscripten_get_now();
+
+    DrawCmd cmd;
+    int n = 0;
+    while (commands.pop(cmd)) {
+        applyCommand(cmd);
+
+        // Most commands cost less than reading the clock
+        if (++n % 32 == 0 && emscripten_get_now() - start > budget_ms) {
+            break;
+        }
+    }
+
+    applyMs = emscripten_get_now() - start;
 }
 
 
-void WsBroker::parse_enter_l3_addr(Context::Store *sCtx, Context::Graphic *gCtx, epoch::AddrAssoc addr_map) {
-        std::string mac_src = Util::fmtEUI48(addr_map.mac_src());
+void WsBroker::adaptPacing() {
+    const int max_coalesce = 16;
 
-        Device::Stats *tran_d_s;
-        auto search = sCtx->_device_map.find(mac_src);
-        if (search != sCtx->_device_map.end()) {
-            tran_d_s = search->second;
-        } else {
-            std::cerr << "tran_d_s l2_ipv4_addr not found! " << mac_src << std::endl;
-            return;
+    double now = emscripten_get_now();
+    // Give the last change time to show up in the lag
+    if (now - lastAdaptMs < 250.0) {
+        return;
+    }
+    lastAdaptMs = now;
+
+    double lag_ms = curr_ws_lag.count()/1000000.0;
+    size_t depth = commands.size();
+    bool idle = frames.size() == 0 && frameBacklog.empty() && depth < commandCapacity/8;
+
+    // Held traffic goes out within lagHighMs, so without an EPOCH_END for
+    // much longer nothing is arriving and the last lag is out of date
+    bool stale = now - lastEpochEndMs > 4*lagHighMs;
+
+    if (depth > commandCapacity/2 || (!stale && lag_ms > lagHighMs)) {
+        pacing.coalesce = std::min(pacing.coalesce*2, max_coalesce);
+    } else if (idle && (stale || lag_ms < lagLowMs)) {
+        pacing.coalesce = std::max(pacing.coalesce/2, 1);
+    }
+
+    // Coalescing keeps all the traffic, only a nearly full queue drops it
+    pacing.skip = depth > commandCapacity*3/4;
+}
+
+
+void WsBroker::enterDevice(uint64_t mac, uint32_t id) {
+    // If the mac is not already in the Store create a new device.
+    // This means that a frame with a never before seen source MAC creates a new Device.
+    Device::Stats *d_s = sCtx->findDevice(mac);
+    if (d_s == nullptr) {
+        // The string form is only for display
+        std::string mac_src = Util::fmtEUI48(mac);
+        d_s = gCtx->createSphere(sCtx, mac_src);
+        gCtx->addDirectLabels(d_s, mac_src);
+    }
+
+    if (id != 0) {
+        if (id >= sCtx->_device_ids.size()) {
+            sCtx->_device_ids.resize(id + 1, nullptr);
+        }
+        sCtx->_device_ids[id] = d_s;
+    }
+}
+
+
+void WsBroker::applyCommand(const DrawCmd &cmd) {
+    static const char *pools[4] = {"33", "ff", "01", "odd"};
+
+    switch (cmd.kind) {
+    case DrawCmd::ENTER_DEVICE:
+        enterDevice(cmd.src_mac, cmd.src_id);
+        break;
+
+    case DrawCmd::TRAFFIC: {
+        Device::Stats *tran_d_s = findDevice(cmd.src_mac, cmd.src_id);
+        Device::Stats *recv_d_s = findDevice(cmd.dst_mac, cmd.dst_id);
+        if (tran_d_s == nullptr || recv_d_s == nullptr) {
+            std::cerr << "traffic device not found! " << Util::fmtEUI48(cmd.src_mac) << " id: " << cmd.src_id;
+            std::cerr << " to " << Util::fmtEUI48(cmd.dst_mac) << " id: " << cmd.dst_id << std::endl;
+            break;
+        }
+
+        gCtx->addFlow(tran_d_s, recv_d_s, Vector4(cmd.cnt[0], cmd.cnt[1], cmd.cnt[2], cmd.cnt[3]));
+        int dev_tot = cmd.cnt[0] + cmd.cnt[1] + cmd.cnt[2] + cmd.cnt[3];
+        tran_d_s->num_pkts_sent += dev_tot;
+        recv_d_s->num_pkts_recv += dev_tot;
+        break;
+    }
+
+    case DrawCmd::POOL_HIT: {
+        Device::Stats *tran_d_s = findDevice(cmd.src_mac, cmd.src_id);
+        if (tran_d_s == nullptr) {
+            std::cerr << "tran_d_s not found! " << Util::fmtEUI48(cmd.src_mac);
+            std::cerr << " id: " << cmd.src_id << std::endl;
+            break;
+        }
+
+        epoch::L2Summary l2sum;
+        l2sum.set_ipv4(cmd.cnt[0]);
+        l2sum.set_ipv6(cmd.cnt[1]);
+        l2sum.set_arp(cmd.cnt[2]);
+        l2sum.set_unknown(cmd.cnt[3]);
+
+        Device::PrefixStats* dp_s = sCtx->_dst_prefix_group_map.at(pools[cmd.pool]);
+        gCtx->createPoolHits(sCtx, tran_d_s, dp_s, l2sum);
+        break;
+    }
+
+    case DrawCmd::L3_ADDR: {
+        Device::Stats *tran_d_s = findDevice(cmd.src_mac, cmd.src_id);
+        if (tran_d_s == nullptr) {
+            std::cerr << "tran_d_s l2_ipv4_addr not found! " << Util::fmtEUI48(cmd.src_mac);
+            std::cerr << " id: " << cmd.src_id << std::endl;
+            break;
         }
 
         if (!tran_d_s->hasIP) {
-            std::string s = Util::uint_to_ipv4addr(addr_map.ipv4());
+            std::string s = Util::uint_to_ipv4addr(cmd.ipv4);
             gCtx->createIPv4Address(sCtx, s, tran_d_s);
         }
-}
-
+        break;
+    }
 
-void WsBroker::parse_arp_table(Context::Store *sCtx, Context::Graphic *gCtx, epoch::ArpAssoc arp_table) {
-        std::string mac_src = Util::fmtEUI48(arp_table.mac_src());
+    case DrawCmd::ARP_ROW: {
+        Device::Stats *tran_d_s = findDevice(cmd.src_mac, 0);
+        if (tran_d_s == nullptr) {
+            std::cerr << "mac_src arp_table not found! " << Util::fmtEUI48(cmd.src_mac) << std::endl;
+            break;
+        }
 
-        Device::Stats *tran_d_s;
-        auto search = sCtx->_device_map.find(mac_src);
-        if (search != sCtx->_device_map.end()) {
-            tran_d_s = search->second;
-        } else {
-            std::cerr << "mac_src arp_table not found! " << mac_src << std::endl;
-            return;
+        Device::Stats *recv_d_s = findDevice(cmd.dst_mac, cmd.dst_id);
+        if (recv_d_s == nullptr) {
+            std::cerr << "mac_dst arp_table not found! " << Util::fmtEUI48(cmd.dst_mac);
+            std::cerr << " id: " << cmd.dst_id << std::endl;
+            break;
         }
 
-        for (int j = 0; j < arp_table.table_row_size(); j++) {
-            epoch::AddrAssoc row = arp_table.table_row(j);
-            std::string mac_dst = Util::fmtEUI48(row.mac_src());
+        // TODO validate ipv4 dest lookup against sCtx
+
+        const Vector3 offset{0.0f, 1.0f, 0.0f};
+        gCtx->addL2ConnectL3(tran_d_s->circPoint, recv_d_s->circPoint+offset);
+        gCtx->addL2ConnectL3(recv_d_s->circPoint+offset, tran_d_s->circPoint);
+        break;
+    }
+
+    case DrawCmd::EPOCH_END: {
+        epoch_packets_sum += cmd.cnt[0];
+
+        double lag_ms = emscripten_get_now() - cmd.ingest_ms;
+        curr_ws_lag = std::chrono::duration<int64_t, std::nano>(static_cast<int64_t>(lag_ms * 1e6));
+        lastEpochEndMs = emscripten_get_now();
+        break;
+    }
+    }
+}
+
 
-            Device::Stats *recv_d_s;
-            auto search2 = sCtx->_device_map.find(mac_dst);
-            if (search2 != sCtx->_device_map.end()) {
-                recv_d_s = search2->second;
+void WsBroker::applyRates(epoch::EpochStep *es) {
+    if (es->encoding() == epoch::KEYFRAME) {
+        rateTable.clear();
+    }
+
+    for (int i = 0; i < es->l2_dev_comm_size(); i++) {
+        const epoch::DeviceComm &dComm = es->l2_dev_comm(i);
+        uint64_t key = dComm.src_id() ? (uint64_t(1) << 63 | dComm.src_id()) : dComm.mac_src();
+        epoch::DeviceComm &row = rateTable[key];
+        row.set_mac_src(dComm.mac_src());
+        row.set_src_id(dComm.src_id());
+
+        // Rows without packets remove the pair
+        for (int k = 0; k < dComm.tx_summary_size(); k++) {
+            const epoch::L2Summary &l2sum = dComm.tx_summary(k);
+            auto *tx = row.mutable_tx_summary();
+
+            int found = -1;
+            for (int m = 0; m < tx->size(); m++) {
+                if (tx->Get(m).mac_dst() == l2sum.mac_dst() && tx->Get(m).dst_id() == l2sum.dst_id()) {
+                    found = m;
+                    break;
+                }
+            }
+
+            if (Util::SumTotal(l2sum) == 0) {
+                if (found >= 0) {
+                    tx->SwapElements(found, tx->size() - 1);
+                    tx->RemoveLast();
+                }
+            } else if (found >= 0) {
+                *tx->Mutable(found) = l2sum;
             } else {
-                std::cerr << "mac_dst arp_table not found! " << mac_dst << std::endl;
-                return;
+                *tx->Add() = l2sum;
             }
+        }
 
-            // TODO validate ipv4 dest lookup against sCtx
-            // int32_t ip_addr_dst = row.ipv4();
+        if (dComm.has_bcast_33()) {
+            if (Util::SumTotal(dComm.bcast_33()) == 0) row.clear_bcast_33();
+            else *row.mutable_bcast_33() = dComm.bcast_33();
+        }
+        if (dComm.has_bcast_ff()) {
+            if (Util::SumTotal(dComm.bcast_ff()) == 0) row.clear_bcast_ff();
+            else *row.mutable_bcast_ff() = dComm.bcast_ff();
+        }
+        if (dComm.has_bcast_01()) {
+            if (Util::SumTotal(dComm.bcast_01()) == 0) row.clear_bcast_01();
+            else *row.mutable_bcast_01() = dComm.bcast_01();
+        }
+        if (dComm.has_bcast_xx()) {
+            if (Util::SumTotal(dComm.bcast_xx()) == 0) row.clear_bcast_xx();
+            else *row.mutable_bcast_xx() = dComm.bcast_xx();
+        }
 
-            const Vector3 offset{0.0f, 1.0f, 0.0f};
-            gCtx->addL2ConnectL3(tran_d_s->circPoint, recv_d_s->circPoint+offset);
-            gCtx->addL2ConnectL3(recv_d_s->circPoint+offset, tran_d_s->circPoint);
+        if (row.tx_summary_size() == 0 && !row.has_bcast_33() && !row.has_bcast_ff() &&
+            !row.has_bcast_01() && !row.has_bcast_xx()) {
+            rateTable.erase(key);
         }
+    }
+
+    es->clear_l2_dev_comm();
+    for (auto it = rateTable.begin(); it != rateTable.end(); it++) {
+        *es->add_l2_dev_comm() = it->second;
+    }
 }
 
 
@@ -222,15 +627,32 @@ WsBroker::WsBroker(std::string ws_uri, Graphic *g, Store *s):
 
     GOOGLE_PROTOBUF_VERIFY_VERSION;
 
+#ifdef __EMSCRIPTEN_PTHREADS__
+    decoder = std::thread(&WsBroker::decodeLoop, this);
+#endif
+
     openSocket(ws_uri);
 }
 
+WsBroker::~WsBroker() {
+    if (decoder.joinable()) {
+        {
+            std::lock_guard<std::mutex> guard(frameLock);
+            stopDecoder = true;
+        }
+        frameCond.notify_one();
+        decoder.join();
+    }
+}
+
 void WsBroker::openSocket(std::string url) {
     EmscriptenWebSocketCreateAttributes attr;
     emscripten_websocket_init_create_attributes(&attr);
 
     attr.url = url.c_str();
 
+    deflate = url.find("compress=deflate") != std::string::npos;
+
     socket = emscripten_websocket_new(&attr);
     if (socket <= 0)
     {
@@ -258,19 +680,31 @@ void WsBroker::closeSocket() {
 }
 
 void WsBroker::statsGui() {
-    auto s = "Sample rate %.3f SPS event cnt %d";
-    if (inv_sample_rate > 1.0) {
-        ImGui::TextColored(ImVec4(1,0,0,1), s, 1.0/inv_sample_rate, event_cnt);
+    auto s = "Queued cmds %zu; frames %zu; events %d/s";
+    size_t depth = commands.size();
+    size_t queued = frames.size() + frameBacklog.size();
+    if (depth > commandCapacity/2 || !frameBacklog.empty()) {
+        ImGui::TextColored(ImVec4(1,0,0,1), s, depth, queued, event_rate);
     } else {
-        ImGui::Text(s, 1.0/inv_sample_rate, event_cnt);
+        ImGui::Text(s, depth, queued, event_rate);
     }
+    ImGui::ProgressBar(static_cast<float>(depth)/commandCapacity, ImVec2(-1, 0), "");
+    ImGui::SliderFloat("Apply budget ms", &applyBudgetMs, 1.0f, 16.0f, "%.1f");
 
-    auto r = "Pkt Lag %.1f ms; Pkt drop: %d; Epoch drop: %d";
+    auto r = "Lag %.1f ms; Apply %.1f ms; Coalesce x%d";
     double t = curr_ws_lag.count()/1000000.0;
-    if (curr_ws_lag > std::chrono::milliseconds(5)) {
-        ImGui::TextColored(ImVec4(1,0,0,1), r, t, tot_ws_drop, tot_epoch_drop);
+    if (curr_ws_lag > std::chrono::milliseconds(static_cast<int64_t>(lagHighMs))) {
+        ImGui::TextColored(ImVec4(1,0,0,1), r, t, applyMs, pacing.coalesce);
     } else {
-        ImGui::Text(r, t, tot_ws_drop, tot_epoch_drop);
+        ImGui::Text(r, t, applyMs, pacing.coalesce);
+    }
+
+    auto d = "Msg drop: %d; Epoch skip: %d; Epoch coalesced: %d";
+    int coalesced = tot_epoch_coalesced;
+    if (tot_ws_drop > 0 || tot_epoch_drop > 0) {
+        ImGui::TextColored(ImVec4(1,0,0,1), d, tot_ws_drop, tot_epoch_drop, coalesced);
+    } else {
+        ImGui::Text(d, tot_ws_drop, tot_epoch_drop, coalesced);
     }
 
     ImGui::Separator();
@@ -281,10 +715,20 @@ void WsBroker::statsGui() {
 }
 
 void WsBroker::frameUpdate() {
-    event_cnt = 0;
-
-    if (event_cnt < 8 && inv_sample_rate > 1) {
-        inv_sample_rate = inv_sample_rate/2;
+#ifdef __EMSCRIPTEN_PTHREADS__
+    flushFrames();
+#else
+    // Without a decoder thread the main thread owns the held traffic
+    flushStaleTraffic();
+#endif
+    applyCommands(applyBudgetMs);
+    adaptPacing();
+
+    double now = emscripten_get_now();
+    if (now - eventWindowMs >= 1000.0) {
+        event_rate = event_cnt;
+        event_cnt = 0;
+        eventWindowMs = now;
     }
 
     ifaceChartMgr.push(static_cast<float>(epoch_packets_sum));